@@ -17,6 +17,8 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <chrono>
+#include <cstring>
 #include <iostream>
 #include <memory>
 
@@ -24,9 +26,11 @@
 #include <opm/parser/eclipse/OpmLog/StreamLog.hpp>
 #include <opm/parser/eclipse/OpmLog/LogUtil.hpp>
 #include <opm/parser/eclipse/OpmLog/OpmLog.hpp>
+#include <opm/parser/eclipse/OpmLog/ProfileLog.hpp>
 
 #include <opm/parser/eclipse/Parser/Parser.hpp>
 #include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Parser/DeckCache.hpp>
 #include <opm/parser/eclipse/Deck/Deck.hpp>
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
 
@@ -45,10 +49,64 @@ void loadDeck( const char * deck_file) {
 }
 
 
+/*
+  With --cache the deck is loaded through a DeckCache stored next to
+  the data file. The first load parses the deck and writes the cache
+  (unless a valid cache is already present), the second load always
+  comes from the cache; the time of both is reported.
+*/
+void loadCachedDeck( const char * deck_file) {
+    Opm::ParseMode parseMode;
+    Opm::ParserPtr parser(new Opm::Parser());
+    Opm::DeckCache cache( parser , Opm::DeckCache::defaultCacheFile( deck_file ));
+    std::shared_ptr<const Opm::Deck> deck;
+    std::shared_ptr<Opm::EclipseState> state;
+
+    std::cout << "Loading deck: " << deck_file << " ..... "; std::cout.flush();
+    auto start = std::chrono::steady_clock::now();
+    deck = cache.parseFile(deck_file, parseMode);
+    std::chrono::duration<double> firstLoad = std::chrono::steady_clock::now() - start;
+    std::cout << (cache.loadedFromCache() ? "loaded from cache" : "parsed - cache written") << " in " << firstLoad.count() << " s" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    deck = cache.parseFile(deck_file, parseMode);
+    std::chrono::duration<double> cachedLoad = std::chrono::steady_clock::now() - start;
+    std::cout << "Loaded from cache: " << cache.getCacheFile().string() << " in " << cachedLoad.count() << " s";
+    if (cachedLoad.count() > 0)
+        std::cout << " - speedup: " << firstLoad.count() / cachedLoad.count();
+    std::cout << std::endl;
+
+    std::cout << "Creating EclipseState .... ";  std::cout.flush();
+    state = std::make_shared<Opm::EclipseState>( deck , parseMode );
+    std::cout << "complete." << std::endl;
+}
+
+
+/*
+  With --profile the time spent on every keyword, input file and
+  EclipseState init step is printed after each deck.
+*/
 int main(int argc, char** argv) {
-    for (int iarg = 1; iarg < argc; iarg++)
-        loadDeck( argv[iarg] );
+    bool useCache = false;
+    std::shared_ptr<Opm::ProfileLog> profileLog;
+    for (int iarg = 1; iarg < argc; iarg++) {
+        if (std::strcmp( argv[iarg] , "--cache" ) == 0)
+            useCache = true;
+        else if (std::strcmp( argv[iarg] , "--profile" ) == 0) {
+            profileLog = std::make_shared<Opm::ProfileLog>();
+            Opm::OpmLog::addBackend( Opm::ProfileLog::BackendName , profileLog );
+        } else {
+            if (useCache)
+                loadCachedDeck( argv[iarg] );
+            else
+                loadDeck( argv[iarg] );
+
+            if (profileLog) {
+                profileLog->printReport( std::cout );
+                profileLog->clear();
+            }
+        }
+    }
 
     return 0;
 }
-
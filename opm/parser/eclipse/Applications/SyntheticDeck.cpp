@@ -0,0 +1,202 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+namespace Opm {
+namespace Benchmark {
+
+    static bool parseOption(const std::string& arg , const std::string& name , size_t& value) {
+        const std::string prefix = "--" + name + "=";
+        if (arg.compare( 0 , prefix.size() , prefix ) != 0)
+            return false;
+
+        value = std::strtoul( arg.c_str() + prefix.size() , nullptr , 10 );
+        return true;
+    }
+
+
+    bool parseDeckOption(const std::string& arg , DeckSize& size) {
+        if (parseOption( arg , "nx" , size.nx ) || parseOption( arg , "ny" , size.ny ) || parseOption( arg , "nz" , size.nz ) ||
+            parseOption( arg , "wells" , size.wells ) || parseOption( arg , "completions" , size.completions ) ||
+            parseOption( arg , "steps" , size.steps ) || parseOption( arg , "summary" , size.summaryVectors ))
+            return true;
+
+        if (arg == "--multipliers")
+            size.multipliers = true;
+        else if (arg == "--compress")
+            size.compress = true;
+        else
+            return false;
+
+        return true;
+    }
+
+
+    static void writeCellProperty(std::ostream& deck , const std::string& keyword , size_t numCells , double base , double step , bool compress) {
+        deck << keyword << std::endl;
+        if (compress) {
+            for (size_t cell = 0; cell < numCells; cell += 10) {
+                size_t count = std::min<size_t>( 10 , numCells - cell );
+                deck << " " << count << "*" << base + step * ((cell / 10) % 100);
+                if ((cell / 10) % 8 == 7)
+                    deck << std::endl;
+            }
+        } else {
+            for (size_t cell = 0; cell < numCells; cell++) {
+                deck << " " << base + step * (cell % 100);
+                if (cell % 10 == 9)
+                    deck << std::endl;
+            }
+        }
+        deck << " /" << std::endl;
+    }
+
+
+    static void writeSummaryVectors(std::ostream& deck , size_t numVectors) {
+        deck << "SUMMARY" << std::endl;
+        for (size_t index = 0; index < numVectors; index++) {
+            switch (index % 5) {
+            case 0:
+                deck << "WOPR" << std::endl << " 'W1' 'W2' /" << std::endl;
+                break;
+            case 1:
+                deck << "WU" << index % 100000 << std::endl << " 'W1' /" << std::endl;
+                break;
+            case 2:
+                deck << "RU" << index % 100000 << std::endl << " 1 2 /" << std::endl;
+                break;
+            case 3:
+                deck << "ROPR_" << index % 1000 << std::endl << " 1 /" << std::endl;
+                break;
+            case 4:
+                deck << "BU" << index % 100000 << std::endl;
+                for (size_t block = 0; block < 5; block++)
+                    deck << " " << block + 1 << " 1 1 /" << std::endl;
+                deck << "/" << std::endl;
+                break;
+            }
+        }
+    }
+
+
+    void writeDeck(std::ostream& deck , const DeckSize& size) {
+        const size_t completions = std::min( size.completions , size.nz );
+
+        deck << "RUNSPEC" << std::endl
+             << "TITLE" << std::endl << " Synthetic benchmark deck" << std::endl
+             << "DIMENS" << std::endl << " " << size.nx << " " << size.ny << " " << size.nz << " /" << std::endl
+             << "OIL" << std::endl << "WATER" << std::endl << "GAS" << std::endl
+             << "METRIC" << std::endl
+             << "TABDIMS" << std::endl << " 1 1 /" << std::endl
+             << "WELLDIMS" << std::endl << " " << size.wells << " " << completions << " 1 " << size.wells << " /" << std::endl
+             << "START" << std::endl << " 1 JAN 2000 /" << std::endl;
+
+        deck << "GRID" << std::endl
+             << "DX" << std::endl << " " << size.cells() << "*100 /" << std::endl
+             << "DY" << std::endl << " " << size.cells() << "*100 /" << std::endl
+             << "DZ" << std::endl << " " << size.cells() << "*5 /" << std::endl
+             << "TOPS" << std::endl << " " << size.nx * size.ny << "*2000 /" << std::endl;
+        writeCellProperty( deck , "PORO" , size.cells() , 0.1 , 0.002 , size.compress );
+        writeCellProperty( deck , "PERMX" , size.cells() , 100 , 5 , size.compress );
+        writeCellProperty( deck , "PERMY" , size.cells() , 100 , 5 , size.compress );
+        writeCellProperty( deck , "PERMZ" , size.cells() , 10 , 0.5 , size.compress );
+        writeCellProperty( deck , "NTG" , size.cells() , 0.5 , 0.005 , size.compress );
+        if (size.multipliers) {
+            writeCellProperty( deck , "MULTX" , size.cells() , 0.5 , 0.01 , size.compress );
+            writeCellProperty( deck , "MULTY" , size.cells() , 0.5 , 0.01 , size.compress );
+            writeCellProperty( deck , "MULTZ" , size.cells() , 0.1 , 0.001 , size.compress );
+        }
+
+        deck << "PROPS" << std::endl
+             << "SWOF" << std::endl
+             << " 0.2 0.0 1.0 0.0" << std::endl
+             << " 0.6 0.4 0.2 0.0" << std::endl
+             << " 1.0 1.0 0.0 0.0 /" << std::endl
+             << "SGOF" << std::endl
+             << " 0.0 0.0 1.0 0.0" << std::endl
+             << " 0.4 0.4 0.2 0.0" << std::endl
+             << " 0.8 1.0 0.0 0.0 /" << std::endl
+             << "DENSITY" << std::endl << " 800 1000 1 /" << std::endl
+             << "PVTW" << std::endl << " 250 1.0 4e-5 0.5 0 /" << std::endl
+             << "ROCK" << std::endl << " 250 5e-5 /" << std::endl;
+
+        if (size.summaryVectors > 0)
+            writeSummaryVectors( deck , size.summaryVectors );
+
+        deck << "SCHEDULE" << std::endl
+             << "WELSPECS" << std::endl;
+        for (size_t well = 0; well < size.wells; well++)
+            deck << " 'W" << well << "' 'G1' " << well % size.nx + 1 << " " << (well / size.nx) % size.ny + 1
+                 << " 1* " << ((well % 4 == 0) ? "'WATER'" : "'OIL'") << " /" << std::endl;
+        deck << "/" << std::endl
+             << "COMPDAT" << std::endl;
+        for (size_t well = 0; well < size.wells; well++)
+            deck << " 'W" << well << "' 2* 1 " << completions << " 'OPEN' 1* 1* 0.2 /" << std::endl;
+        deck << "/" << std::endl;
+
+        for (size_t step = 0; step < size.steps; step++) {
+            deck << "WCONPROD" << std::endl;
+            for (size_t well = 0; well < size.wells; well++) {
+                if (well % 4 != 0)
+                    deck << " 'W" << well << "' 'OPEN' 'ORAT' " << 1000 + 10 * (step % 50) << " 4* 100 /" << std::endl;
+            }
+            deck << "/" << std::endl
+                 << "WCONINJE" << std::endl;
+            for (size_t well = 0; well < size.wells; well += 4)
+                deck << " 'W" << well << "' 'WATER' 'OPEN' 'RATE' " << 2000 + 10 * (step % 50) << " 1* 500 /" << std::endl;
+            deck << "/" << std::endl
+                 << "TSTEP" << std::endl << " 30 /" << std::endl;
+        }
+    }
+
+
+    std::string createDeck(const DeckSize& size) {
+        std::ostringstream deck;
+        writeDeck( deck , size );
+        return deck.str();
+    }
+
+
+    void writeDeckFile(const std::string& fileName , const DeckSize& size) {
+        std::ofstream stream( fileName );
+        writeDeck( stream , size );
+        if (!stream)
+            throw std::runtime_error("Failed to write the deck: " + fileName);
+    }
+
+
+    long peakMemoryKB() {
+        struct rusage usage;
+        getrusage( RUSAGE_SELF , &usage );
+        return usage.ru_maxrss;
+    }
+
+}
+}
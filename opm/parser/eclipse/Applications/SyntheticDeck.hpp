@@ -0,0 +1,88 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef SYNTHETIC_DECK_HPP
+#define SYNTHETIC_DECK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+/*
+  The synthetic deck generator and the measurement helpers shared by
+  the benchmark applications. A deck has the sections
+
+    RUNSPEC   DIMENS, phases, TABDIMS, WELLDIMS and START
+    GRID      DX, DY, DZ and TOPS, and the cell properties PORO, PERMX,
+              PERMY, PERMZ and NTG; optionally MULTX, MULTY and MULTZ
+    PROPS     one saturation table and the fluid and rock data
+    SUMMARY   optionally user defined vectors, which are only
+              recognized by the wildcard keywords
+    SCHEDULE  WELSPECS and COMPDAT for all wells, and WCONPROD,
+              WCONINJE and TSTEP for every report step
+
+  The sizes are given by DeckSize, which the benchmarks set up with
+  their own defaults and then update from the command line options
+  --nx=N, --ny=N, --nz=N, --wells=N, --completions=N, --steps=N,
+  --summary=N, --multipliers and --compress.
+*/
+
+namespace Opm {
+namespace Benchmark {
+
+    struct DeckSize {
+        size_t nx = 100;
+        size_t ny = 100;
+        size_t nz = 10;
+        size_t wells = 100;
+        size_t completions = 5;
+        size_t steps = 100;
+        size_t summaryVectors = 0;
+        bool multipliers = false;
+        // The cell properties are written with repeat counts, 10*0.25.
+        bool compress = false;
+
+        size_t cells() const {
+            return nx * ny * nz;
+        }
+    };
+
+    // Returns false for an argument which is not one of the size options.
+    bool parseDeckOption(const std::string& arg , DeckSize& size);
+
+    void writeDeck(std::ostream& deck , const DeckSize& size);
+    std::string createDeck(const DeckSize& size);
+    // Throws std::runtime_error if the file can not be written.
+    void writeDeckFile(const std::string& fileName , const DeckSize& size);
+
+    // The peak resident memory of the process.
+    long peakMemoryKB();
+
+    template <typename Function>
+    double timeStage(Function function) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+}
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Measures the heap memory held by a parsed Deck for a schedule heavy
+  synthetic deck, i.e. a large number of small records. The global
+  operator new and delete, and their array forms, are replaced to
+  count the live heap bytes; the memory of the Deck is the difference
+  before and after parsing, with the input string allocated up front.
+
+  Usage: opm-deck-memory-benchmark [size options]
+
+  The size options are described in SyntheticDeck.hpp; the default is
+  a 10x10x10 grid with 100 wells and 1000 report steps.
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+using namespace Opm::Benchmark;
+
+
+static std::atomic<long long> liveBytes(0);
+static std::atomic<long long> numAllocations(0);
+
+
+/*
+  The size of a block is stored in front of it. The union is as large
+  and as aligned as the fundamental types, so the block handed out
+  keeps the alignment of malloc().
+*/
+union BlockHeader {
+    std::size_t size;
+    long double alignLongDouble;
+    long long alignLongLong;
+    void* alignPointer;
+};
+
+
+static void* countedAllocate(std::size_t size) {
+    BlockHeader* header = static_cast<BlockHeader*>( std::malloc( sizeof(BlockHeader) + size ));
+    if (!header)
+        throw std::bad_alloc();
+
+    header->size = size;
+    liveBytes += size;
+    numAllocations++;
+    return header + 1;
+}
+
+
+static void countedFree(void* ptr) {
+    if (!ptr)
+        return;
+
+    BlockHeader* header = static_cast<BlockHeader*>( ptr ) - 1;
+    liveBytes -= header->size;
+    std::free( header );
+}
+
+
+/*
+  Only the unsized operator delete is replaced; the default sized
+  versions forward to it.
+*/
+void* operator new(std::size_t size) {
+    return countedAllocate( size );
+}
+
+
+void* operator new[](std::size_t size) {
+    return countedAllocate( size );
+}
+
+
+void operator delete(void* ptr) noexcept {
+    countedFree( ptr );
+}
+
+
+void operator delete[](void* ptr) noexcept {
+    countedFree( ptr );
+}
+
+
+int main(int argc, char** argv) {
+    DeckSize size;
+    size.nx = 10;
+    size.ny = 10;
+    size.nz = 10;
+    size.steps = 1000;
+    for (int iarg = 1; iarg < argc; iarg++) {
+        if (!parseDeckOption( argv[iarg] , size )) {
+            std::cerr << "Unknown argument: " << argv[iarg] << std::endl;
+            return 1;
+        }
+    }
+
+    Opm::ParseMode parseMode;
+    Opm::ParserPtr parser(new Opm::Parser());
+    std::string deckString = createDeck( size );
+
+    long long bytesBefore = liveBytes;
+    long long allocationsBefore = numAllocations;
+    Opm::DeckConstPtr deck = parser->parseString( deckString , parseMode );
+    long long deckBytes = liveBytes - bytesBefore;
+    long long deckAllocations = numAllocations - allocationsBefore;
+
+    size_t numRecords = 0;
+    for (const auto& keyword : *deck)
+        numRecords += keyword->size();
+
+    std::cout << "Keywords            : " << deck->size() << std::endl
+              << "Records             : " << numRecords << std::endl
+              << "Deck heap memory    : " << std::fixed << std::setprecision(1) << deckBytes / (1024.0 * 1024.0) << " MB" << std::endl
+              << "Bytes per record    : " << std::setprecision(0) << double(deckBytes) / numRecords << std::endl
+              << "Allocations (parse) : " << deckAllocations << " (" << std::setprecision(1) << double(deckAllocations) / numRecords << " per record)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Memory report for the GridProperty storage modes. The properties
+  EclipseState typically holds on a large grid are created directly:
+  the six transmissibility multipliers which TransMult creates with
+  the constant 1.0, and the region properties SATNUM, PVTNUM, EQLNUM
+  and FIPNUM. The region properties are filled with typical values and
+  compressed, as at the end of the EclipseState construction. For
+  every property the bytes of the full array and the bytes actually
+  used are printed.
+
+  Usage: opm-grid-property-memory [--nx=N] [--ny=N] [--nz=N]
+
+  The grid options are those of SyntheticDeck.hpp; the default is a
+  1000x1000x100 grid.
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+using namespace Opm::Benchmark;
+
+
+template <typename T>
+static void report(const Opm::GridProperty<T>& property , size_t& totalFull , size_t& totalUsed) {
+    const size_t fullBytes = property.getCartesianSize() * sizeof(T);
+    const size_t usedBytes = property.getMemoryUsage();
+    std::cout << std::setw(10) << property.getKeywordName()
+              << std::setw(12) << std::fixed << std::setprecision(1) << fullBytes / (1024.0 * 1024.0) << " MB"
+              << std::setw(12) << usedBytes / (1024.0 * 1024.0) << " MB" << std::endl;
+
+    totalFull += fullBytes;
+    totalUsed += usedBytes;
+}
+
+
+int main(int argc, char** argv) {
+    DeckSize size;
+    size.nx = 1000;
+    size.ny = 1000;
+    size.nz = 100;
+    for (int iarg = 1; iarg < argc; iarg++) {
+        if (!parseDeckOption( argv[iarg] , size )) {
+            std::cerr << "Unknown argument: " << argv[iarg] << std::endl;
+            return 1;
+        }
+    }
+
+    const size_t nx = size.nx;
+    const size_t ny = size.ny;
+    const size_t nz = size.nz;
+
+    std::cout << "Grid: " << nx << " x " << ny << " x " << nz << " = " << nx * ny * nz << " cells" << std::endl;
+    std::cout << std::setw(10) << "keyword" << std::setw(15) << "full" << std::setw(15) << "used" << std::endl;
+
+    size_t totalFull = 0;
+    size_t totalUsed = 0;
+
+    std::vector<std::unique_ptr<Opm::GridProperty<double> > > multipliers;
+    for (const char* name : { "MULTX" , "MULTX-" , "MULTY" , "MULTY-" , "MULTZ" , "MULTZ-" }) {
+        Opm::GridPropertySupportedKeywordInfo<double> kwInfo( name , 1.0 , "1" );
+        multipliers.emplace_back( new Opm::GridProperty<double>( nx , ny , nz , kwInfo ));
+        report( *multipliers.back() , totalFull , totalUsed );
+    }
+
+    // name, number of regions and the number of cells per region.
+    const std::vector<std::tuple<std::string , int , size_t> > regions = {
+        std::make_tuple( "SATNUM" , 3 , nx * ny ),
+        std::make_tuple( "PVTNUM" , 1 , nx * ny * nz ),
+        std::make_tuple( "EQLNUM" , 10 , nx ),
+        std::make_tuple( "FIPNUM" , 1000 , 100 )
+    };
+
+    std::vector<std::unique_ptr<Opm::GridProperty<int> > > regionProperties;
+    for (const auto& region : regions) {
+        Opm::GridPropertySupportedKeywordInfo<int> kwInfo( std::get<0>(region) , 1 , "1" );
+        regionProperties.emplace_back( new Opm::GridProperty<int>( nx , ny , nz , kwInfo ));
+
+        auto& property = *regionProperties.back();
+        const int numRegions = std::get<1>(region);
+        const size_t cellsPerRegion = std::get<2>(region);
+        if (numRegions > 1) {
+            for (size_t g = 0; g < property.getCartesianSize(); g++)
+                property.iset( g , 1 + static_cast<int>( (g / cellsPerRegion) % numRegions ));
+        }
+        property.compress();
+        report( property , totalFull , totalUsed );
+    }
+
+    std::cout << std::setw(10) << "total"
+              << std::setw(12) << std::fixed << std::setprecision(1) << totalFull / (1024.0 * 1024.0) << " MB"
+              << std::setw(12) << totalUsed / (1024.0 * 1024.0) << " MB" << std::endl;
+    std::cout << "Peak RSS: " << peakMemoryKB() / 1024 << " MB" << std::endl;
+
+    return 0;
+}
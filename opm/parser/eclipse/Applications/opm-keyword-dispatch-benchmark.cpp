@@ -0,0 +1,160 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Benchmark for the keyword dispatch in Schedule::iterateScheduleSection()
+  on a SCHEDULE section with a large number of keywords. The dispatch
+  on the interned keyword ids - a switch on DeckKeyword::getKeywordId() -
+  is compared with the chain of std::string comparisons it replaced,
+  and the total time to create the Schedule is reported.
+
+  Usage: opm-keyword-dispatch-benchmark [size options]
+
+  The size options are described in SyntheticDeck.hpp; the default is
+  a 10x10x10 grid with 10 wells and 16667 report steps of three
+  keywords each, i.e. 50000 SCHEDULE keywords.
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Parser/ParserKeywords.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/parser/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+using namespace Opm::Benchmark;
+
+
+// The names compared - in sequence, for every keyword - by the string based dispatch.
+static const std::vector<std::string> scheduleKeywords = {
+    "DATES", "TSTEP", "WELSPECS", "WCONHIST", "WCONPROD", "WCONINJE", "WPOLYMER", "WSOLVENT",
+    "WCONINJH", "WGRUPCON", "COMPDAT", "WELSEGS", "COMPSEGS", "WELOPEN", "WELTARG", "GRUPTREE",
+    "GCONINJE", "GCONPROD", "TUNING", "NOSIM", "RPTRST", "RPTSCHED", "WRFT", "WRFTPLT",
+    "WPIMULT", "COMPORD", "DRSDT", "DRVDT", "VAPPARS" };
+
+
+static size_t stringDispatch(const Opm::Deck& deck) {
+    size_t handled = 0;
+    for (const auto& keyword : deck) {
+        for (const auto& name : scheduleKeywords) {
+            if (keyword->name() == name)
+                handled += name.size();
+        }
+    }
+    return handled;
+}
+
+
+static size_t idDispatch(const Opm::Deck& deck) {
+    using namespace Opm::ParserKeywords;
+    size_t handled = 0;
+    for (const auto& keyword : deck) {
+        switch (getKeywordId( *keyword )) {
+        case DATES::keywordId:     handled += 5; break;
+        case TSTEP::keywordId:     handled += 5; break;
+        case WELSPECS::keywordId:  handled += 8; break;
+        case WCONHIST::keywordId:  handled += 8; break;
+        case WCONPROD::keywordId:  handled += 8; break;
+        case WCONINJE::keywordId:  handled += 8; break;
+        case WPOLYMER::keywordId:  handled += 8; break;
+        case WSOLVENT::keywordId:  handled += 8; break;
+        case WCONINJH::keywordId:  handled += 8; break;
+        case WGRUPCON::keywordId:  handled += 8; break;
+        case COMPDAT::keywordId:   handled += 7; break;
+        case WELSEGS::keywordId:   handled += 7; break;
+        case COMPSEGS::keywordId:  handled += 8; break;
+        case WELOPEN::keywordId:   handled += 7; break;
+        case WELTARG::keywordId:   handled += 7; break;
+        case GRUPTREE::keywordId:  handled += 8; break;
+        case GCONINJE::keywordId:  handled += 8; break;
+        case GCONPROD::keywordId:  handled += 8; break;
+        case TUNING::keywordId:    handled += 6; break;
+        case NOSIM::keywordId:     handled += 5; break;
+        case RPTRST::keywordId:    handled += 6; break;
+        case RPTSCHED::keywordId:  handled += 8; break;
+        case WRFT::keywordId:      handled += 4; break;
+        case WRFTPLT::keywordId:   handled += 7; break;
+        case WPIMULT::keywordId:   handled += 7; break;
+        case COMPORD::keywordId:   handled += 7; break;
+        case DRSDT::keywordId:     handled += 5; break;
+        case DRVDT::keywordId:     handled += 5; break;
+        case VAPPARS::keywordId:   handled += 7; break;
+        default: break;
+        }
+    }
+    return handled;
+}
+
+
+template <typename Dispatch>
+static void run(const std::string& label, const Opm::Deck& deck, size_t repeats, Dispatch dispatch) {
+    size_t checksum = 0;
+    double elapsed = timeStage( [&]() {
+            for (size_t repeat = 0; repeat < repeats; repeat++)
+                checksum += dispatch(deck);
+        });
+
+    std::cout << std::setw(20) << label
+              << std::setw(12) << std::fixed << std::setprecision(4) << elapsed / repeats << " s"
+              << std::setw(10) << std::setprecision(1) << 1e9 * elapsed / (repeats * deck.size()) << " ns/keyword"
+              << "   (checksum " << checksum << ")" << std::endl;
+}
+
+
+int main(int argc, char** argv) {
+    DeckSize size;
+    size.nx = 10;
+    size.ny = 10;
+    size.nz = 10;
+    size.wells = 10;
+    size.steps = 16667;
+    for (int iarg = 1; iarg < argc; iarg++) {
+        if (!parseDeckOption( argv[iarg] , size )) {
+            std::cerr << "Unknown argument: " << argv[iarg] << std::endl;
+            return 1;
+        }
+    }
+
+    Opm::ParseMode parseMode;
+    Opm::ParserPtr parser(new Opm::Parser());
+    Opm::DeckConstPtr deck = parser->parseString( createDeck( size ) , parseMode );
+    std::cout << "Keywords in deck: " << deck->size() << std::endl;
+
+    run("string dispatch", *deck, 20, stringDispatch);
+    run("keyword id dispatch", *deck, 20, idDispatch);
+
+    {
+        std::shared_ptr<const Opm::EclipseGrid> grid = std::make_shared<const Opm::EclipseGrid>( deck );
+        Opm::IOConfigPtr ioConfig = std::make_shared<Opm::IOConfig>();
+        std::shared_ptr<const Opm::Schedule> schedule;
+        double elapsed = timeStage( [&]() { schedule = std::make_shared<const Opm::Schedule>( parseMode , grid , deck , ioConfig ); } );
+        std::cout << std::setw(20) << "Schedule" << std::setw(12) << std::setprecision(4) << elapsed << " s"
+                  << "   (" << schedule->getTimeMap()->numTimesteps() << " report steps)" << std::endl;
+    }
+
+    return 0;
+}
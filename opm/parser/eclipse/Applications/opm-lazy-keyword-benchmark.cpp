@@ -0,0 +1,89 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Benchmark for lazily parsed keywords: a synthetic deck with the GRID
+  properties and the MULTX, MULTY and MULTZ multipliers, of which only
+  PORO is used, is parsed with and without Parser::setLazyKeywords().
+  The peak memory is a property of the process, so one mode is run per
+  invocation.
+
+  Usage: opm-lazy-keyword-benchmark lazy|eager [size options]
+
+  The size options are described in SyntheticDeck.hpp; the default is
+  a 500000x1x1 grid without wells and report steps.
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+using namespace Opm::Benchmark;
+
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " lazy|eager [size options]" << std::endl;
+        return 1;
+    }
+
+    const bool lazy = (std::string( argv[1] ) == "lazy");
+    DeckSize size;
+    size.nx = 500000;
+    size.ny = 1;
+    size.nz = 1;
+    size.wells = 0;
+    size.steps = 0;
+    size.multipliers = true;
+    for (int iarg = 2; iarg < argc; iarg++) {
+        if (!parseDeckOption( argv[iarg] , size )) {
+            std::cerr << "Unknown argument: " << argv[iarg] << std::endl;
+            return 1;
+        }
+    }
+
+    std::string deckString = createDeck( size );
+    long deckMemoryKB = peakMemoryKB();
+
+    Opm::ParseMode parseMode;
+    Opm::ParserPtr parser(new Opm::Parser());
+    parser->setLazyKeywords( lazy );
+
+    Opm::DeckConstPtr deck;
+    double parseTime = timeStage( [&]() { deck = parser->parseString( deckString , parseMode ); } );
+
+    double sum = 0;
+    double accessTime = timeStage( [&]() {
+            for (double value : deck->getKeyword("PORO")->getSIDoubleData())
+                sum += value;
+        });
+
+    std::cout << (lazy ? "lazy " : "eager") << " parse: " << std::fixed << std::setprecision(3) << parseTime << " s"
+              << "   PORO access: " << accessTime << " s"
+              << "   peak memory above the deck string: " << (peakMemoryKB() - deckMemoryKB) / 1024 << " MB"
+              << "   (mean PORO " << sum / size.cells() << ")" << std::endl;
+
+    return 0;
+}
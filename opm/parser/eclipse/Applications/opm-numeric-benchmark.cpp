@@ -0,0 +1,136 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Micro benchmark for the numeric token conversion used by
+  ParserItem::scan(). The readValueToken<int> and readValueToken<double>
+  functions are compared with the boost::lexical_cast based conversion
+  they replaced, and the throughput is reported in tokens/second.
+
+  Usage: opm-numeric-benchmark [number of tokens (default 10000000)]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+
+#include <opm/parser/eclipse/RawDeck/StarToken.hpp>
+
+
+static double legacyReadDouble(const std::string& valueString) {
+    try {
+        return boost::lexical_cast<double>(valueString);
+    }
+    catch (boost::bad_lexical_cast&) {
+        std::string vs(valueString);
+        std::replace(vs.begin(), vs.end(), 'D', 'E');
+        std::replace(vs.begin(), vs.end(), 'd', 'e');
+        return boost::lexical_cast<double>(vs);
+    }
+}
+
+
+static int legacyReadInt(const std::string& valueString) {
+    return boost::lexical_cast<int>(valueString);
+}
+
+
+static std::vector<std::string> createDoubleTokens(size_t numTokens) {
+    std::vector<std::string> tokens;
+    char buffer[64];
+
+    std::srand(42);
+    tokens.reserve(numTokens);
+    for (size_t i = 0; i < numTokens; i++) {
+        double value = std::rand() / 1000.0 - 1000.0;
+        switch (i % 4) {
+        case 0:
+            std::snprintf(buffer, sizeof buffer, "%.4f", value);
+            break;
+        case 1:
+            std::snprintf(buffer, sizeof buffer, "%.6g", value);
+            break;
+        case 2:
+            std::snprintf(buffer, sizeof buffer, "%.3E", value);
+            break;
+        default:
+            // Fortran style exponent, e.g. 1.23D+02
+            std::snprintf(buffer, sizeof buffer, "%.2E", value);
+            std::replace(buffer, buffer + sizeof buffer, 'E', 'D');
+        }
+
+        tokens.push_back(buffer);
+    }
+    return tokens;
+}
+
+
+static std::vector<std::string> createIntTokens(size_t numTokens) {
+    std::vector<std::string> tokens;
+
+    std::srand(42);
+    tokens.reserve(numTokens);
+    for (size_t i = 0; i < numTokens; i++)
+        tokens.push_back(std::to_string(std::rand() % 100000 - 50000));
+
+    return tokens;
+}
+
+
+template <typename T, typename Convert>
+static void run(const std::string& label, const std::vector<std::string>& tokens, Convert convert) {
+    T sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& token : tokens)
+        sum += convert(token);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::setw(20) << label
+              << std::setw(12) << std::fixed << std::setprecision(3) << elapsed.count() << " s"
+              << std::setw(14) << std::setprecision(0) << tokens.size() / elapsed.count() << " tokens/s"
+              << "   (checksum " << std::setprecision(2) << sum << ")" << std::endl;
+}
+
+
+int main(int argc, char** argv) {
+    size_t numTokens = 10000000;
+    if (argc > 1)
+        numTokens = std::strtoul(argv[1], nullptr, 10);
+
+    {
+        std::vector<std::string> tokens = createDoubleTokens(numTokens);
+        run<double>("double lexical_cast", tokens, legacyReadDouble);
+        run<double>("double readValue", tokens, [](const std::string& token) { return Opm::readValueToken<double>(token); });
+    }
+
+    {
+        std::vector<std::string> tokens = createIntTokens(numTokens);
+        run<long>("int lexical_cast", tokens, legacyReadInt);
+        run<long>("int readValue", tokens, [](const std::string& token) { return Opm::readValueToken<int>(token); });
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Parser scaling benchmark. A synthetic deck is generated from the
+  size parameters and written to a file, which is then timed through
+  the three stages separately:
+
+    parse          Parser::parseFile()
+    eclipse_state  the EclipseState constructor, which includes a Schedule
+    schedule       the Schedule constructor on its own
+
+  The result is printed as one line of JSON, e.g. to be appended to a
+  file of results for tracking regressions between releases:
+
+    {"nx":100,"ny":100,"nz":10,"cells":100000,...,"parse_s":0.41,...,"peak_rss_kb":81234}
+
+  Usage: opm-parser-benchmark [size options] [--deck=FILE] [--generate-only]
+
+  The size options are described in SyntheticDeck.hpp; the defaults
+  are a 100x100x10 grid, 100 wells with 5 completions and 100 report
+  steps. With --compress the decks for 10^8 cells stay at a manageable
+  size. The generated deck is removed unless --deck is given;
+  --generate-only only writes the deck.
+*/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/parser/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+using namespace Opm::Benchmark;
+
+
+int main(int argc, char** argv) {
+    DeckSize size;
+    std::string deckFile;
+    bool generateOnly = false;
+
+    for (int iarg = 1; iarg < argc; iarg++) {
+        const std::string arg = argv[iarg];
+        if (parseDeckOption( arg , size ))
+            continue;
+
+        if (arg == "--generate-only")
+            generateOnly = true;
+        else if (arg.compare( 0 , 7 , "--deck=" ) == 0)
+            deckFile = arg.substr( 7 );
+        else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    const bool removeDeck = deckFile.empty();
+    if (removeDeck)
+        deckFile = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path( "opm-parser-benchmark-%%%%%%%%.DATA" )).string();
+
+    double generateTime = timeStage( [&]() { writeDeckFile( deckFile , size ); } );
+    const double deckBytes = static_cast<double>( boost::filesystem::file_size( deckFile ));
+    if (generateOnly) {
+        std::cerr << "Wrote " << deckFile << " (" << deckBytes / (1024 * 1024) << " MB) in " << generateTime << " s" << std::endl;
+        return 0;
+    }
+
+    Opm::ParseMode parseMode;
+    Opm::ParserPtr parser(new Opm::Parser());
+    Opm::DeckConstPtr deck;
+    Opm::EclipseStateConstPtr state;
+    Opm::ScheduleConstPtr schedule;
+
+    double parseTime = timeStage( [&]() { deck = parser->parseFile( deckFile , parseMode ); } );
+    double stateTime = timeStage( [&]() { state = std::make_shared<const Opm::EclipseState>( deck , parseMode ); } );
+    double scheduleTime = timeStage( [&]() {
+            Opm::IOConfigPtr ioConfig = std::make_shared<Opm::IOConfig>();
+            schedule = std::make_shared<const Opm::Schedule>( parseMode , state->getEclipseGrid() , deck , ioConfig );
+        });
+
+    if (removeDeck)
+        boost::filesystem::remove( deckFile );
+
+    std::ostringstream result;
+    result << "{\"nx\":" << size.nx << ",\"ny\":" << size.ny << ",\"nz\":" << size.nz
+           << ",\"cells\":" << size.cells() << ",\"wells\":" << size.wells
+           << ",\"completions\":" << size.completions << ",\"steps\":" << size.steps
+           << ",\"summary\":" << size.summaryVectors
+           << ",\"multipliers\":" << (size.multipliers ? "true" : "false")
+           << ",\"compress\":" << (size.compress ? "true" : "false")
+           << ",\"deck_bytes\":" << static_cast<size_t>( deckBytes )
+           << ",\"keywords\":" << deck->size()
+           << ",\"parse_s\":" << parseTime
+           << ",\"parse_mb_per_s\":" << deckBytes / (1024 * 1024) / parseTime
+           << ",\"parse_keywords_per_s\":" << deck->size() / parseTime
+           << ",\"eclipse_state_s\":" << stateTime
+           << ",\"eclipse_state_cells_per_s\":" << size.cells() / stateTime
+           << ",\"schedule_s\":" << scheduleTime
+           << ",\"schedule_steps_per_s\":" << schedule->getTimeMap()->numTimesteps() / scheduleTime
+           << ",\"peak_rss_kb\":" << peakMemoryKB() << "}";
+    std::cout << result.str() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Benchmark for section selective parsing: a synthetic deck with a
+  small grid and a large SCHEDULE section is parsed completely, and
+  with only the RUNSPEC and GRID sections selected - as a grid builder
+  would do.
+
+  Usage: opm-section-parse-benchmark [size options]
+
+  The size options are described in SyntheticDeck.hpp; the default is
+  a 20x20x10 grid with 100 wells and 2000 report steps.
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+using namespace Opm::Benchmark;
+
+
+static void run(const std::string& label , Opm::ParserConstPtr parser , const std::string& deckString) {
+    Opm::ParseMode parseMode;
+    Opm::DeckConstPtr deck;
+    double elapsed = timeStage( [&]() { deck = parser->parseString( deckString , parseMode ); } );
+
+    std::cout << std::setw(16) << label
+              << std::setw(10) << std::fixed << std::setprecision(3) << elapsed << " s"
+              << "   (" << deck->size() << " keywords, PORO: " << deck->getKeyword("PORO")->getRawDoubleData().size() << " values)" << std::endl;
+}
+
+
+int main(int argc, char** argv) {
+    DeckSize size;
+    size.nx = 20;
+    size.ny = 20;
+    size.nz = 10;
+    size.steps = 2000;
+    for (int iarg = 1; iarg < argc; iarg++) {
+        if (!parseDeckOption( argv[iarg] , size )) {
+            std::cerr << "Unknown argument: " << argv[iarg] << std::endl;
+            return 1;
+        }
+    }
+
+    std::string deckString = createDeck( size );
+    std::cout << "Deck size: " << deckString.size() / (1024 * 1024) << " MB" << std::endl;
+
+    Opm::ParserPtr parser(new Opm::Parser());
+    run("full deck" , parser , deckString);
+
+    parser->setParseSections( { "RUNSPEC" , "GRID" } );
+    run("RUNSPEC+GRID" , parser , deckString);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Scans a deck with Parser::streamFile() without building a Deck. The
+  location and size of the keywords given on the command line are
+  printed, e.g. all the SCHEDULE keywords of interest; at the end the
+  input files - the INCLUDE dependencies - are listed together with
+  the number of keywords and the peak resident memory, which does not
+  grow with the size of the deck.
+
+  Usage: opm-stream-deck DATA_FILE [KEYWORD ...]
+*/
+
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " DATA_FILE [KEYWORD ...]" << std::endl;
+        return 1;
+    }
+
+    std::set<std::string> selected( argv + 2 , argv + argc );
+    std::vector<std::string> inputFiles;
+    std::map<std::string , size_t> keywordsPerFile;
+    size_t numKeywords = 0;
+
+    Opm::ParseMode parseMode;
+    Opm::ParserPtr parser(new Opm::Parser());
+    parser->streamFile( argv[1] , parseMode , [&](Opm::DeckKeywordConstPtr keyword) {
+            const std::string& fileName = keyword->getFileName();
+            if (keywordsPerFile.count( fileName ) == 0)
+                inputFiles.push_back( fileName );
+            keywordsPerFile[fileName]++;
+            numKeywords++;
+
+            if (selected.count( keyword->name() ))
+                std::cout << fileName << ":" << keyword->getLineNumber() << " " << keyword->name()
+                          << " (" << keyword->size() << " records)" << std::endl;
+            return true;
+        });
+
+    std::cout << std::endl << "Input files:" << std::endl;
+    for (const auto& fileName : inputFiles)
+        std::cout << "  " << fileName << " : " << keywordsPerFile[fileName] << " keywords" << std::endl;
+
+    std::cout << "Keywords            : " << numKeywords << std::endl
+              << "Peak resident memory: " << Opm::Benchmark::peakMemoryKB() / 1024 << " MB" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Compares the two input paths of the parser on a synthetic deck
+  dominated by the large grid property keywords:
+
+    mmap   : Parser::parseFile() - the file is memory mapped and the
+             lines are passed on as views into the mapping.
+
+    stream : Parser::parseStream() - the file is read through
+             std::getline() on an std::ifstream.
+
+  Usage: opm-tokenizer-benchmark [size options] [--deck=FILE]
+
+  The size options are described in SyntheticDeck.hpp; the default is
+  a 1000x1000x10 grid without wells and report steps, about 240 MB. A
+  deck file which already exists is used as it is; otherwise the deck
+  is generated, and without --deck removed when the benchmark
+  completes.
+*/
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+using namespace Opm::Benchmark;
+
+
+static void report(const std::string& label, size_t bytes, double seconds, Opm::DeckConstPtr deck) {
+    double megaBytes = bytes / (1024.0 * 1024.0);
+    std::cout << std::setw(8) << label
+              << std::setw(12) << std::fixed << std::setprecision(3) << seconds << " s"
+              << std::setw(12) << std::setprecision(1) << megaBytes / seconds << " MB/s"
+              << std::setw(10) << deck->size() << " keywords" << std::endl;
+}
+
+
+int main(int argc, char** argv) {
+    DeckSize size;
+    size.nx = 1000;
+    size.ny = 1000;
+    size.nz = 10;
+    size.wells = 0;
+    size.steps = 0;
+    boost::filesystem::path deckFile;
+    bool removeDeck = false;
+
+    for (int iarg = 1; iarg < argc; iarg++) {
+        const std::string arg = argv[iarg];
+        if (parseDeckOption( arg , size ))
+            continue;
+
+        if (arg.compare( 0 , 7 , "--deck=" ) == 0)
+            deckFile = arg.substr( 7 );
+        else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    if (deckFile.empty()) {
+        deckFile = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("opm-tokenizer-%%%%%%.DATA");
+        removeDeck = true;
+    }
+
+    if (!boost::filesystem::exists(deckFile)) {
+        std::cout << "Writing synthetic deck: " << deckFile.string() << " ... "; std::cout.flush();
+        writeDeckFile(deckFile.string(), size);
+        std::cout << "done." << std::endl;
+    }
+
+    size_t bytes = boost::filesystem::file_size(deckFile);
+    Opm::ParseMode parseMode;
+    Opm::ParserPtr parser(new Opm::Parser());
+
+    {
+        Opm::DeckConstPtr deck;
+        double elapsed = timeStage( [&]() { deck = parser->parseFile(deckFile.string(), parseMode); } );
+        report("mmap", bytes, elapsed, deck);
+    }
+
+    {
+        Opm::DeckConstPtr deck;
+        double elapsed = timeStage( [&]() {
+                std::shared_ptr<std::istream> stream = std::make_shared<std::ifstream>(deckFile.string().c_str());
+                deck = parser->parseStream(stream, parseMode);
+            });
+        report("stream", bytes, elapsed, deck);
+    }
+
+    if (removeDeck)
+        boost::filesystem::remove(deckFile);
+
+    return 0;
+}
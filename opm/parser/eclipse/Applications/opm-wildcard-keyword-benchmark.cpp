@@ -0,0 +1,119 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Benchmark for the recognition of wildcard (deck_name_regex) keywords
+  on a SUMMARY section with a large number of user defined vectors,
+  i.e. names like WU..., RU... and BU... which are only matched by the
+  regular expressions. The compiled matcher used by
+  Parser::isRecognizedKeyword() is compared with matching every
+  wildcard ParserKeyword in turn, and the time to parse the deck is
+  reported.
+
+  Usage: opm-wildcard-keyword-benchmark [size options]
+
+  The size options are described in SyntheticDeck.hpp; the default is
+  a 10x10x10 grid with 20000 SUMMARY vectors and no wells or report
+  steps. The number of names matched is the number of SUMMARY vectors.
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Parser/ParserKeyword.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Applications/SyntheticDeck.hpp>
+
+using namespace Opm::Benchmark;
+
+
+static std::vector<std::string> candidateNames(size_t numNames) {
+    const std::vector<std::string> prefixes = { "WU" , "RU" , "BU" , "ROPR_" , "FU" , "CU" , "GU" , "XY" , "TVDP" };
+    std::vector<std::string> names;
+    for (size_t index = 0; index < numNames; index++)
+        names.push_back( prefixes[index % prefixes.size()] + std::to_string( index % 1000 ));
+    return names;
+}
+
+
+template <typename Recognize>
+static void run(const std::string& label, const std::vector<std::string>& names, size_t repeats, Recognize recognize) {
+    size_t recognized = 0;
+    double elapsed = timeStage( [&]() {
+            for (size_t repeat = 0; repeat < repeats; repeat++) {
+                for (const auto& name : names)
+                    recognized += recognize( name ) ? 1 : 0;
+            }
+        });
+
+    std::cout << std::setw(20) << label
+              << std::setw(10) << std::fixed << std::setprecision(1) << 1e9 * elapsed / (repeats * names.size()) << " ns/name"
+              << "   (" << recognized / repeats << " of " << names.size() << " recognized)" << std::endl;
+}
+
+
+int main(int argc, char** argv) {
+    DeckSize size;
+    size.nx = 10;
+    size.ny = 10;
+    size.nz = 10;
+    size.wells = 0;
+    size.steps = 0;
+    size.summaryVectors = 20000;
+    for (int iarg = 1; iarg < argc; iarg++) {
+        if (!parseDeckOption( argv[iarg] , size )) {
+            std::cerr << "Unknown argument: " << argv[iarg] << std::endl;
+            return 1;
+        }
+    }
+
+    Opm::ParseMode parseMode;
+    Opm::ParserPtr parser(new Opm::Parser());
+
+    std::vector<Opm::ParserKeywordConstPtr> wildCardKeywords;
+    for (const auto& name : { "BLOCK_PROBE" , "CONNECTION_PROBE" , "FIELD_PROBE" , "GROUP_PROBE" , "REGION_PROBE" , "TVDP" , "WELL_PROBE" })
+        wildCardKeywords.push_back( parser->getParserKeywordFromInternalName( name ));
+
+    std::vector<std::string> names = candidateNames( size.summaryVectors );
+    run("regex per keyword", names, 5, [&wildCardKeywords](const std::string& name) {
+            for (const auto& parserKeyword : wildCardKeywords) {
+                if (parserKeyword->matches( name ))
+                    return true;
+            }
+            return false;
+        });
+    run("compiled matcher", names, 5, [&parser](const std::string& name) {
+            return parser->isRecognizedKeyword( name );
+        });
+
+    {
+        std::string deckString = createDeck( size );
+        Opm::DeckConstPtr deck;
+        double elapsed = timeStage( [&]() { deck = parser->parseString( deckString , parseMode ); } );
+        std::cout << std::setw(20) << "parse deck" << std::setw(10) << std::setprecision(3) << elapsed << " s"
+                  << "   (" << deck->size() << " keywords)" << std::endl;
+    }
+
+    return 0;
+}
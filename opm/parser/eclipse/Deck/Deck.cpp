@@ -17,6 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
 #include <vector>
 #include <iostream>
 
@@ -27,43 +30,94 @@ namespace Opm {
     Deck::Deck() {
     }
 
+
+    const std::vector<DeckKeywordConstPtr>* Deck::findKeywordList(const std::string& keyword) const {
+        if (m_hashTable.empty())
+            return nullptr;
+
+        const size_t mask = m_hashTable.size() - 1;
+        size_t slot = std::hash<std::string>()( keyword ) & mask;
+        while (m_hashTable[slot] != 0) {
+            const std::vector<DeckKeywordConstPtr>& keywordList = m_keywordLists[ m_hashTable[slot] - 1 ];
+            if (keywordList.front()->name() == keyword)
+                return &keywordList;
+
+            slot = (slot + 1) & mask;
+        }
+        return nullptr;
+    }
+
+
+    std::vector<DeckKeywordConstPtr>& Deck::findOrAddKeywordList(const std::string& keyword) {
+        if (2 * (m_keywordLists.size() + 1) > m_hashTable.size())
+            rehash( std::max<size_t>( 16 , 2 * m_hashTable.size() ));
+
+        const size_t mask = m_hashTable.size() - 1;
+        size_t slot = std::hash<std::string>()( keyword ) & mask;
+        while (m_hashTable[slot] != 0) {
+            std::vector<DeckKeywordConstPtr>& keywordList = m_keywordLists[ m_hashTable[slot] - 1 ];
+            if (keywordList.front()->name() == keyword)
+                return keywordList;
+
+            slot = (slot + 1) & mask;
+        }
+
+        m_keywordLists.push_back( std::vector<DeckKeywordConstPtr>() );
+        m_hashTable[slot] = m_keywordLists.size();
+        return m_keywordLists.back();
+    }
+
+
+    void Deck::rehash(size_t tableSize) {
+        m_hashTable.assign( tableSize , 0 );
+
+        const size_t mask = tableSize - 1;
+        for (size_t listIndex = 0; listIndex < m_keywordLists.size(); listIndex++) {
+            size_t slot = std::hash<std::string>()( m_keywordLists[listIndex].front()->name() ) & mask;
+            while (m_hashTable[slot] != 0)
+                slot = (slot + 1) & mask;
+
+            m_hashTable[slot] = listIndex + 1;
+        }
+    }
+
+
+    void Deck::reserve(size_t numKeywords) {
+        m_keywordList.reserve( numKeywords );
+        m_keywordIndex.reserve( numKeywords );
+    }
+
+
     bool Deck::hasKeyword(DeckKeywordConstPtr keyword) const {
-        return (m_keywordIndex.find( const_cast<DeckKeyword *>(keyword.get()) ) != m_keywordIndex.end());
+        return m_keywordIndex.find( keyword.get() ) != m_keywordIndex.end();
     }
 
 
     bool Deck::hasKeyword(const std::string& keyword) const {
-        return (m_keywordMap.find(keyword) != m_keywordMap.end());
+        return findKeywordList( keyword ) != nullptr;
     }
 
     void Deck::addKeyword( DeckKeywordConstPtr keyword) {
-        m_keywordIndex[ keyword.get() ] = m_keywordList.size();
+        // a keyword added twice keeps the first position
+        m_keywordIndex.emplace( keyword.get() , m_keywordList.size() );
         m_keywordList.push_back(keyword);
-
-        if (!hasKeyword(keyword->name())) {
-            m_keywordMap[keyword->name()] = std::vector<DeckKeywordConstPtr>();
-        }
-
-        {
-            std::vector<DeckKeywordConstPtr>& keywordList = m_keywordMap[keyword->name()];
-            keywordList.push_back(keyword);
-        }
+        findOrAddKeywordList( keyword->name() ).push_back( keyword );
     }
 
     size_t Deck::getKeywordIndex(DeckKeywordConstPtr keyword) const {
-        auto iter = m_keywordIndex.find( const_cast<DeckKeyword *>(keyword.get()));
+        auto iter = m_keywordIndex.find( keyword.get() );
         if (iter == m_keywordIndex.end())
             throw std::invalid_argument("Keyword " + keyword->name() + " not in deck.");
 
-        return (*iter).second;
+        return iter->second;
     }
 
 
     DeckKeywordConstPtr Deck::getKeyword(const std::string& keyword, size_t index) const {
-        if (hasKeyword(keyword)) {
-            const std::vector<DeckKeywordConstPtr>& keywordList = getKeywordList( keyword );
-            if (index < keywordList.size())
-                return keywordList[index];
+        const std::vector<DeckKeywordConstPtr>* keywordList = findKeywordList( keyword );
+        if (keywordList) {
+            if (index < keywordList->size())
+                return (*keywordList)[index];
             else
                 throw std::out_of_range("Keyword " + keyword + ":" + std::to_string( index ) + " not in deck.");
         } else
@@ -71,10 +125,10 @@ namespace Opm {
     }
 
     DeckKeywordConstPtr Deck::getKeyword(const std::string& keyword) const {
-        if (hasKeyword(keyword)) {
-            const std::vector<DeckKeywordConstPtr>& keywordList = getKeywordList( keyword );
-            return keywordList.back();
-        } else
+        const std::vector<DeckKeywordConstPtr>* keywordList = findKeywordList( keyword );
+        if (keywordList)
+            return keywordList->back();
+        else
             throw std::invalid_argument("Keyword " + keyword + " not in deck.");
     }
 
@@ -86,18 +140,18 @@ namespace Opm {
     }
 
     size_t Deck::numKeywords(const std::string& keyword) const {
-        if (hasKeyword(keyword)) {
-            const std::vector<DeckKeywordConstPtr>& keywordList = getKeywordList( keyword );
-            return keywordList.size();
-        } else
+        const std::vector<DeckKeywordConstPtr>* keywordList = findKeywordList( keyword );
+        if (keywordList)
+            return keywordList->size();
+        else
             return 0;
     }
 
     const std::vector<DeckKeywordConstPtr>& Deck::getKeywordList(const std::string& keyword) const {
-        if (hasKeyword(keyword)) {
-            const std::vector<DeckKeywordConstPtr>& keywordList = m_keywordMap.find(keyword)->second;
-            return keywordList;
-        } else
+        const std::vector<DeckKeywordConstPtr>* keywordList = findKeywordList( keyword );
+        if (keywordList)
+            return *keywordList;
+        else
             return m_emptyList;
     }
 
@@ -110,6 +164,15 @@ namespace Opm {
     }
 
 
+    void Deck::addInputFile(const std::string& fileName) {
+        m_inputFiles.push_back( fileName );
+    }
+
+    const std::vector<std::string>& Deck::getInputFiles() const {
+        return m_inputFiles;
+    }
+
+
     size_t Deck::size() const {
         return m_keywordList.size();
     }
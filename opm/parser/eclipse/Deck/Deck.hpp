@@ -20,6 +20,8 @@
 #ifndef DECK_HPP
 #define DECK_HPP
 
+#include <deque>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -34,6 +36,8 @@ namespace Opm {
         bool hasKeyword(DeckKeywordConstPtr keyword) const;
         bool hasKeyword( const std::string& keyword ) const;
         void addKeyword( DeckKeywordConstPtr keyword);
+        // pre-sizes the keyword storage for numKeywords keywords
+        void reserve(size_t numKeywords);
         DeckKeywordConstPtr getKeyword(const std::string& keyword , size_t index) const;
         DeckKeywordConstPtr getKeyword(const std::string& keyword) const;
         DeckKeywordConstPtr getKeyword(size_t index) const;
@@ -50,6 +54,10 @@ namespace Opm {
         std::vector<DeckKeywordConstPtr>::const_iterator begin() const;
         std::vector<DeckKeywordConstPtr>::const_iterator end() const;
 
+        // The files the deck was parsed from: the root file followed by all the INCLUDE files.
+        void addInputFile(const std::string& fileName);
+        const std::vector<std::string>& getInputFiles() const;
+
 
         template <class Keyword>
         bool hasKeyword() const {
@@ -76,10 +84,29 @@ namespace Opm {
         std::shared_ptr<UnitSystem> m_activeUnits;
 
     private:
+        const std::vector<DeckKeywordConstPtr>* findKeywordList(const std::string& keyword) const;
+        std::vector<DeckKeywordConstPtr>& findOrAddKeywordList(const std::string& keyword);
+        void rehash(size_t tableSize);
+
         std::vector<DeckKeywordConstPtr> m_emptyList;
         std::vector<DeckKeywordConstPtr> m_keywordList;
-        std::map<std::string, std::vector<DeckKeywordConstPtr> > m_keywordMap;
-        std::map<const DeckKeyword *, size_t> m_keywordIndex;
+
+        // The position of each keyword in m_keywordList. A keyword can
+        // be held by several decks, so the position is kept here and
+        // never on the shared DeckKeyword.
+        std::unordered_map<const DeckKeyword*, size_t> m_keywordIndex;
+
+        // One list per keyword name in the order of first occurrence; a
+        // deque so references returned by getKeywordList() stay valid.
+        std::deque<std::vector<DeckKeywordConstPtr> > m_keywordLists;
+
+        // Open addressing hash table with linear probing from keyword
+        // name to m_keywordLists; a slot holds the list index + 1, and 0
+        // marks an empty slot. The size is a power of two and the table
+        // is at most half full.
+        std::vector<size_t> m_hashTable;
+
+        std::vector<std::string> m_inputFiles;
     };
 
     typedef std::shared_ptr<Deck> DeckPtr;
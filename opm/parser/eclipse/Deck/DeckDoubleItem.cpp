@@ -29,22 +29,91 @@ namespace Opm {
 
     double DeckDoubleItem::getRawDouble(size_t index) const {
         assertSize(index);
+        if (!hasRawData())
+            throw std::logic_error("The raw data of item: " + name() + " has been converted to SI");
 
         return m_data[index];
     }
 
 
     const std::vector<double>& DeckDoubleItem::getRawDoubleData() const {
+        if (!hasRawData())
+            throw std::logic_error("The raw data of item: " + name() + " has been converted to SI");
+
         return m_data;
     }
 
 
+    bool DeckDoubleItem::hasRawData() const {
+        return m_SIstate != SI_IN_PLACE;
+    }
+
+
+    /*
+      The values are converted one dimension at a time; with a single
+      dimension - the common case - this is a plain multiply-add loop
+      over contiguous memory which the compiler can vectorize.
+    */
+    static void convertValuesToSI(const std::vector<double>& rawData,
+                                  std::vector<double>& SIdata,
+                                  const std::vector<std::shared_ptr<const Dimension> >& dimensions) {
+        const size_t size = rawData.size();
+        const size_t stride = dimensions.size();
+        const double* raw = rawData.data();
+        double* SI = SIdata.data();
+
+        for (size_t dimIndex = 0; dimIndex < stride; dimIndex++) {
+            const double factor = dimensions[dimIndex]->getSIScaling();
+            const double offset = dimensions[dimIndex]->getSIOffset();
+
+            if (stride == 1) {
+                for (size_t index = 0; index < size; index++)
+                    SI[index] = raw[index] * factor + offset;
+            } else {
+                for (size_t index = dimIndex; index < size; index += stride)
+                    SI[index] = raw[index] * factor + offset;
+            }
+        }
+    }
+
+
+    void DeckDoubleItem::convertToSI(bool keepRawData) {
+        if (m_SIstate != SI_LAZY || m_dimensions.empty())
+            return;
+
+        // Items with a context dependent unit can not be converted; they
+        // are left for the lazy conversion which will throw on access.
+        for (const auto& dimension : m_dimensions) {
+            if (dimension->isContextDependent())
+                return;
+        }
+
+        if (keepRawData) {
+            m_SIdata.resize( m_data.size() );
+            convertValuesToSI( m_data , m_SIdata , m_dimensions );
+            m_SIstate = SI_SEPARATE;
+        } else {
+            convertValuesToSI( m_data , m_data , m_dimensions );
+            m_SIdata.clear();
+            m_SIdata.shrink_to_fit();
+            m_SIstate = SI_IN_PLACE;
+        }
+    }
+
+
     void DeckDoubleItem::assertSIData() const {
+        if (m_SIstate != SI_LAZY)
+            return;
+
         if (m_dimensions.size() > 0) {
             if (m_SIdata.size() > 0) {
                 // we already converted this item to SI!
                 return;
             }
+            // a context dependent unit throws before m_SIdata is touched
+            for (const auto& dimension : m_dimensions)
+                dimension->convertRawToSi( 0 );
+
             m_SIdata.resize( m_data.size() );
 
             for (size_t index=0; index < m_data.size(); index++) {
@@ -61,13 +130,13 @@ namespace Opm {
         assertSize(index);
         assertSIData();
 
-        return m_SIdata[index];
+        return (m_SIstate == SI_IN_PLACE) ? m_data[index] : m_SIdata[index];
     }
 
     const std::vector<double>& DeckDoubleItem::getSIDoubleData() const {
         assertSIData();
 
-        return m_SIdata;
+        return (m_SIstate == SI_IN_PLACE) ? m_data : m_SIdata;
     }
 
 
@@ -109,6 +178,12 @@ namespace Opm {
     }
 
 
+    void DeckDoubleItem::reserve(size_t numValues) {
+        m_data.reserve( numValues );
+        m_dataPointDefaulted.reserve( numValues );
+    }
+
+
     void DeckDoubleItem::push_backDefault(double data) {
         if (m_dataPointDefaulted.size() != m_data.size())
             throw std::logic_error("To add a value to an item, no \"pseudo defaults\" can be added before");
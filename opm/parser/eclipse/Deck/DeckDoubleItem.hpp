@@ -45,18 +45,37 @@ namespace Opm {
         // trying to access the data of a "dummy default item" will raise an exception
         void push_backDummyDefault();
         void push_backMultiple(double value, size_t numValues);
+        void reserve(size_t numValues);
         void push_backDimension(std::shared_ptr<const Dimension> activeDimension , std::shared_ptr<const Dimension> defaultDimension);
 
+        // Converts all values to SI right away; afterwards the SI data
+        // is accessed without any hidden allocation. Unless keepRawData
+        // is true the values are converted in place, and the raw data
+        // is no longer available.
+        void convertToSI(bool keepRawData = true);
+        bool hasRawData() const;
+
         size_t size() const;
     private:
+        enum SIState {
+            SI_LAZY,      // m_SIdata is created on first access
+            SI_SEPARATE,  // m_SIdata holds the converted values
+            SI_IN_PLACE   // m_data holds the converted values
+        };
+
+        // serializes the item data directly
+        friend class DeckCache;
+
         void assertSIData() const;
 
         std::vector<double> m_data;
         // mutable is required because the data is "lazily" converted
         // to SI units in asserSIData() which needs to be callable by
-        // 'const'-decorated methods
+        // 'const'-decorated methods. The lazy conversion is not thread
+        // safe; use convertToSI() before sharing the item between threads.
         mutable std::vector<double> m_SIdata;
         std::vector<std::shared_ptr<const Dimension> > m_dimensions;
+        SIState m_SIstate = SI_LAZY;
     };
 
     typedef std::shared_ptr<DeckDoubleItem> DeckDoubleItemPtr;
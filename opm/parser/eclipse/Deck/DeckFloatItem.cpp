@@ -107,6 +107,12 @@ namespace Opm {
     }
 
 
+    void DeckFloatItem::reserve(size_t numValues) {
+        m_data.reserve( numValues );
+        m_dataPointDefaulted.reserve( numValues );
+    }
+
+
     void DeckFloatItem::push_backDefault(float data) {
         if (m_dataPointDefaulted.size() != m_data.size())
             throw std::logic_error("To add a value to an item, no \"pseudo defaults\" can be added before");
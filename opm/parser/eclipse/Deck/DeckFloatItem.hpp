@@ -44,10 +44,14 @@ namespace Opm {
         // trying to access the data of a "dummy default item" will raise an exception
         void push_backDummyDefault();
         void push_backMultiple(float value, size_t numValues);
+        void reserve(size_t numValues);
         void push_backDimension(std::shared_ptr<const Dimension> activeDimension , std::shared_ptr<const Dimension> defaultDimension);
 
         size_t size() const;
     private:
+        // serializes the item data directly
+        friend class DeckCache;
+
         void assertSIData() const;
 
         std::vector<float> m_data;
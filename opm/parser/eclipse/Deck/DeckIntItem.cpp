@@ -86,6 +86,12 @@ namespace Opm {
     }
 
 
+    void DeckIntItem::reserve(size_t numValues) {
+        m_data.reserve( numValues );
+        m_dataPointDefaulted.reserve( numValues );
+    }
+
+
     size_t DeckIntItem::size() const {
         return m_data.size();
     }
@@ -41,10 +41,14 @@ namespace Opm {
         // trying to access the data of a "dummy default item" will raise an exception
         void push_backDummyDefault();
         void push_backMultiple(int value , size_t numValues);
+        void reserve(size_t numValues);
         void push_backDefault(int value);
 
         size_t size() const;
     private:
+        // serializes the item data directly
+        friend class DeckCache;
+
         std::vector<int> m_data;
     };
 
@@ -22,12 +22,77 @@
 
 #include <opm/parser/eclipse/Units/Dimension.hpp>
 
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <vector>
 #include <memory>
 
 namespace Opm {
+
+    /*
+      The defaulted flags of the values in a DeckItem. The vast majority
+      of items hold only a handful of values; the flags of the first 64
+      values are stored inline and only larger items allocate.
+    */
+    class DeckItemDefaultFlags {
+    public:
+        DeckItemDefaultFlags() :
+            m_size( 0 ),
+            m_inline( 0 )
+        { }
+
+        size_t size() const {
+            return m_size;
+        }
+
+        bool empty() const {
+            return m_size == 0;
+        }
+
+        bool operator[](size_t index) const {
+            if (index < inlineFlags)
+                return (m_inline >> index) & 1;
+
+            index -= inlineFlags;
+            return (m_overflow[index / inlineFlags] >> (index % inlineFlags)) & 1;
+        }
+
+        bool back() const {
+            return (*this)[m_size - 1];
+        }
+
+        void push_back(bool flag) {
+            size_t index = m_size;
+            m_size++;
+
+            if (index < inlineFlags) {
+                if (flag)
+                    m_inline |= uint64_t(1) << index;
+                return;
+            }
+
+            index -= inlineFlags;
+            if (index % inlineFlags == 0)
+                m_overflow.push_back( 0 );
+            if (flag)
+                m_overflow.back() |= uint64_t(1) << (index % inlineFlags);
+        }
+
+        void reserve(size_t numFlags) {
+            if (numFlags > inlineFlags)
+                m_overflow.reserve( (numFlags - 1) / inlineFlags );
+        }
+
+    private:
+        static const size_t inlineFlags = 64;
+
+        size_t m_size;
+        uint64_t m_inline;
+        std::vector<uint64_t> m_overflow;
+    };
+
+
     class DeckItem {
     public:
         DeckItem(const std::string& name , bool m_scalar = true);
@@ -116,9 +181,12 @@ namespace Opm {
     protected:
         void assertSize(size_t index) const;
 
-        std::vector<bool> m_dataPointDefaulted;
+        DeckItemDefaultFlags m_dataPointDefaulted;
 
     private:
+        // serializes the item data directly
+        friend class DeckCache;
+
         std::string m_name;
         bool m_scalar;
     };
@@ -18,23 +18,84 @@
  */
 
 #include "DeckKeyword.hpp"
+#include <opm/parser/eclipse/Deck/DeckDoubleItem.hpp>
+#include <opm/parser/eclipse/Parser/ParserKeyword.hpp>
 
 namespace Opm {
 
     DeckKeyword::DeckKeyword(const std::string& keywordName) {
-        m_knownKeyword = true;
-        m_keywordName = keywordName;
-        m_isDataKeyword = false;
-        m_fileName = "";
-        m_lineNumber = -1;
+        commonInit(keywordName , true);
     }
 
     DeckKeyword::DeckKeyword(const std::string& keywordName, bool knownKeyword) {
+        commonInit(keywordName , knownKeyword);
+    }
+
+    DeckKeyword::DeckKeyword(std::shared_ptr<const ParserKeyword> parserKeyword,
+                             std::shared_ptr<RawKeyword> rawKeyword,
+                             std::shared_ptr<LazyParseContext> lazyContext) {
+        commonInit(rawKeyword->getKeywordName() , true);
+        setLocation(rawKeyword->getFilename() , rawKeyword->getLineNR());
+        setDataKeyword(parserKeyword->isDataKeyword());
+        setParserKeyword(parserKeyword);
+
+        m_rawKeyword = rawKeyword;
+        m_lazyContext = lazyContext;
+        m_isParsed = false;
+    }
+
+    void DeckKeyword::commonInit(const std::string& keywordName, bool knownKeyword) {
         m_knownKeyword = knownKeyword;
         m_keywordName = keywordName;
         m_isDataKeyword = false;
         m_fileName = "";
         m_lineNumber = -1;
+        m_keywordId = -1;
+        m_isParsed = true;
+    }
+
+    bool DeckKeyword::isParsed() const {
+        return m_isParsed.load(std::memory_order_acquire);
+    }
+
+    void DeckKeyword::ensureParsed() const {
+        if (!m_isParsed.load(std::memory_order_acquire) || m_parseError)
+            parseRecords();
+    }
+
+    /*
+      The records are parsed exactly once, by the first thread which
+      gets here; ParserRecord::parse() consumes the raw records, so a
+      failed parse is not repeated but the error is rethrown. The SI
+      data is created here as well, the lazy conversion in
+      DeckDoubleItem::getSIDoubleData() is not thread safe.
+    */
+    void DeckKeyword::parseRecords() const {
+        std::call_once( m_parseOnce , [this]() {
+                try {
+                    DeckKeywordPtr parsedKeyword = m_parserKeyword->parse( *m_lazyContext->parseMode , m_rawKeyword );
+                    if (m_lazyContext->activeUnits && m_parserKeyword->hasDimension()) {
+                        std::lock_guard<std::mutex> lock( m_lazyContext->unitMutex );
+                        m_parserKeyword->applyUnits( m_lazyContext->activeUnits , m_lazyContext->defaultUnits , parsedKeyword );
+
+                        for (const auto& record : *parsedKeyword) {
+                            for (size_t itemIndex = 0; itemIndex < record->size(); itemIndex++) {
+                                auto doubleItem = std::dynamic_pointer_cast<DeckDoubleItem>( record->getItem( itemIndex ));
+                                if (doubleItem)
+                                    doubleItem->convertToSI( m_lazyContext->keepRawData );
+                            }
+                        }
+                    }
+                    m_recordList.swap( parsedKeyword->m_recordList );
+                } catch (...) {
+                    m_parseError = std::current_exception();
+                }
+                m_rawKeyword.reset();
+                m_isParsed.store( true , std::memory_order_release );
+            });
+
+        if (m_parseError)
+            std::rethrow_exception( m_parseError );
     }
 
     void DeckKeyword::setLocation(const std::string& fileName, int lineNumber) {
@@ -62,6 +123,11 @@ namespace Opm {
 
     void DeckKeyword::setParserKeyword(std::shared_ptr<const ParserKeyword> &parserKeyword) {
         m_parserKeyword = parserKeyword;
+        m_keywordId = parserKeyword ? parserKeyword->getKeywordId() : -1;
+    }
+
+    int DeckKeyword::getKeywordId() const {
+        return m_keywordId;
     }
 
     void DeckKeyword::setDataKeyword(bool isDataKeyword_) {
@@ -78,6 +144,7 @@ namespace Opm {
     }
 
     size_t DeckKeyword::size() const {
+        ensureParsed();
         return m_recordList.size();
     }
 
@@ -86,18 +153,22 @@ namespace Opm {
     }
 
     void DeckKeyword::addRecord(DeckRecordConstPtr record) {
+        ensureParsed();
         m_recordList.push_back(record);
     }
 
     std::vector<DeckRecordConstPtr>::const_iterator DeckKeyword::begin() const {
+        ensureParsed();
         return m_recordList.begin();
     }
 
     std::vector<DeckRecordConstPtr>::const_iterator DeckKeyword::end() const {
+        ensureParsed();
         return m_recordList.end();
     }
 
     DeckRecordConstPtr DeckKeyword::getRecord(size_t index) const {
+        ensureParsed();
         if (index < m_recordList.size()) {
             return m_recordList[index];
         } else
@@ -106,7 +177,7 @@ namespace Opm {
 
 
     DeckRecordConstPtr DeckKeyword::getDataRecord() const {
-        if (m_recordList.size() == 1)
+        if (size() == 1)
             return getRecord(0);
         else
             throw std::range_error("Not a data keyword ?");
@@ -8,20 +8,55 @@
 #ifndef DECKKEYWORD_HPP
 #define DECKKEYWORD_HPP
 
+#include <atomic>
+#include <exception>
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #include <opm/parser/eclipse/Deck/DeckRecord.hpp>
 
 namespace Opm {
     class ParserKeyword;
+    class ParseMode;
+    class RawKeyword;
+    class UnitSystem;
+
+    /// Shared by the lazily parsed keywords of one deck, see
+    /// Parser::setLazyKeywords(): a copy of the ParseMode, and the unit
+    /// systems of the deck which are set when the parsing is complete.
+    /// The double items are converted to SI when the keyword is parsed;
+    /// keepRawData is false when the parser converts in place.
+    struct LazyParseContext {
+        std::shared_ptr<const ParseMode> parseMode;
+        std::shared_ptr<UnitSystem> activeUnits;
+        std::shared_ptr<UnitSystem> defaultUnits;
+        bool keepRawData = true;
+        // UnitSystem::getNewDimension() is not thread safe
+        std::mutex unitMutex;
+    };
 
     class DeckKeyword {
     public:
         DeckKeyword(const std::string& keywordName);
         DeckKeyword(const std::string& keywordName, bool knownKeyword);
 
+        /*!
+         * \brief A lazily parsed keyword.
+         *
+         * The raw keyword is kept, and parsed with the parser keyword
+         * the first time the records are accessed - also when that
+         * happens concurrently from several threads. Errors in the
+         * records are reported then, the same error on every access.
+         */
+        DeckKeyword(std::shared_ptr<const ParserKeyword> parserKeyword,
+                    std::shared_ptr<RawKeyword> rawKeyword,
+                    std::shared_ptr<LazyParseContext> lazyContext);
+
+        // false for a lazily parsed keyword until the records are accessed
+        bool isParsed() const;
+
         const std::string& name() const;
         void setLocation(const std::string& fileName, int lineNumber);
         const std::string& getFileName() const;
@@ -39,6 +74,11 @@ namespace Opm {
 
         void setParserKeyword(std::shared_ptr<const ParserKeyword> &parserKeyword);
 
+        // The generated ParserKeywords::XXX::keywordId of the parser
+        // keyword; -1 if the keyword has no generated parser keyword.
+        // See also ParserKeywords::getKeywordId().
+        int getKeywordId() const;
+
         size_t size() const;
         void addRecord(DeckRecordConstPtr record);
         DeckRecordConstPtr getRecord(size_t index) const;
@@ -71,9 +111,22 @@ namespace Opm {
         int m_lineNumber;
 
         std::shared_ptr<const ParserKeyword> m_parserKeyword;
-        std::vector<DeckRecordConstPtr> m_recordList;
+        // filled on first access for a lazily parsed keyword, hence mutable.
+        mutable std::vector<DeckRecordConstPtr> m_recordList;
         bool m_knownKeyword;
         bool m_isDataKeyword;
+        int m_keywordId;
+
+        // lazy parsing; the raw keyword is released when it is parsed.
+        mutable std::shared_ptr<RawKeyword> m_rawKeyword;
+        std::shared_ptr<LazyParseContext> m_lazyContext;
+        mutable std::atomic<bool> m_isParsed;
+        mutable std::once_flag m_parseOnce;
+        mutable std::exception_ptr m_parseError;
+
+        void commonInit(const std::string& keywordName, bool knownKeyword);
+        void ensureParsed() const;
+        void parseRecords() const;
     };
     typedef std::shared_ptr<DeckKeyword> DeckKeywordPtr;
     typedef std::shared_ptr<const DeckKeyword> DeckKeywordConstPtr;
@@ -34,11 +34,24 @@ namespace Opm {
         return m_items.size();
     }
 
+    void DeckRecord::reserve(size_t numItems) {
+        m_items.reserve( numItems );
+    }
+
+
+    std::vector<DeckItemPtr>::const_iterator DeckRecord::findItem(const std::string& name) const {
+        for (auto iter = m_items.begin(); iter != m_items.end(); ++iter) {
+            if ((*iter)->name() == name)
+                return iter;
+        }
+        return m_items.end();
+    }
+
+
     void DeckRecord::addItem(DeckItemPtr deckItem) {
-        if (m_itemMap.find(deckItem->name()) == m_itemMap.end()) {
-            m_itemMap[deckItem->name()] = deckItem;
+        if (findItem(deckItem->name()) == m_items.end())
             m_items.push_back(deckItem);
-        } else
+        else
             throw std::invalid_argument("Item with name: " + deckItem->name() + " already exists in DeckRecord");
     }
 
@@ -51,16 +64,14 @@ namespace Opm {
 
 
     bool DeckRecord::hasItem(const std::string& name) const {
-        if (m_itemMap.find(name) == m_itemMap.end())
-            return false;
-        else
-            return true;
+        return findItem(name) != m_items.end();
     }
 
     
     DeckItemPtr DeckRecord::getItem(const std::string& name) const {
-        if (hasItem(name))
-            return m_itemMap.find(name)->second;
+        auto iter = findItem(name);
+        if (iter != m_items.end())
+            return *iter;
         else
             throw std::invalid_argument("Itemname: " + name + " does not exist.");
     }
@@ -33,6 +33,7 @@ namespace Opm {
     public:
         DeckRecord();
         size_t size() const;
+        void reserve(size_t numItems);
         void addItem(DeckItemPtr deckItem);
         DeckItemPtr getItem(size_t index) const;
         DeckItemPtr getItem(const std::string& name) const;
@@ -46,8 +47,12 @@ namespace Opm {
 
 
     private:
+        std::vector<DeckItemPtr>::const_iterator findItem(const std::string& name) const;
+
+        // the items are looked up by name with a linear search; records
+        // are small and a separate name map would dominate the memory
+        // of schedule heavy decks.
         std::vector<DeckItemPtr> m_items;
-        std::map<std::string, DeckItemPtr> m_itemMap;
 
     };
     typedef std::shared_ptr<DeckRecord> DeckRecordPtr;
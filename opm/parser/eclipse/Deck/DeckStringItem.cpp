@@ -85,6 +85,12 @@ namespace Opm {
     }
 
 
+    void DeckStringItem::reserve(size_t numValues) {
+        m_data.reserve( numValues );
+        m_dataPointDefaulted.reserve( numValues );
+    }
+
+
     void DeckStringItem::push_backDefault(std::string data) {
         if (m_dataPointDefaulted.size() != m_data.size())
             throw std::logic_error("To add a value to an item, no \"pseudo defaults\" can be added before");
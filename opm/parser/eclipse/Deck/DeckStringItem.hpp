@@ -45,9 +45,13 @@ namespace Opm {
         // trying to access the data of a "dummy default item" will raise an exception
         void push_backDummyDefault();
         void push_backMultiple(std::string value, size_t numItems);
+        void reserve(size_t numValues);
 
         size_t size() const;
     private:
+        // serializes the item data directly
+        friend class DeckCache;
+
         std::vector<std::string> m_data;
     };
 
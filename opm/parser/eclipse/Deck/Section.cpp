@@ -33,38 +33,122 @@
 
 namespace Opm {
     Section::Section(DeckConstPtr deck, const std::string& startKeywordName)
-        : m_name(startKeywordName)
+        : m_name(startKeywordName),
+          m_deck(deck),
+          m_begin(0),
+          m_end(0)
     {
-        m_defaultUnits = deck->getDefaultUnitSystem();
-        m_activeUnits = deck->getActiveUnitSystem();
-
-        populateSection(deck, startKeywordName);
+        findSection(startKeywordName);
     }
 
-    void Section::populateSection(DeckConstPtr deck, const std::string& startKeywordName)
+    void Section::findSection(const std::string& startKeywordName)
     {
-        bool inSection = false;
-        for (auto iter = deck->begin(); iter != deck->end(); ++iter) {
-            auto keyword = *iter;
-            if (!inSection) {
-                if (keyword->name() == startKeywordName) {
-                    inSection = true;
-                    addKeyword(keyword);
-                }
-            } else {
-                if (keyword->name() == startKeywordName)
-                    throw std::invalid_argument(std::string("Deck contains the '")+startKeywordName+"' section multiple times");
+        const std::vector<DeckKeywordConstPtr>& startKeywords = m_deck->getKeywordList(startKeywordName);
+        if (startKeywords.empty())
+            throw std::invalid_argument(std::string("Deck requires a '")+startKeywordName+"' section");
 
-                if (isSectionDelimiter(keyword->name()))
-                    break;
+        m_begin = m_deck->getKeywordIndex(startKeywords.front());
+        m_end = m_begin + 1;
+        while (m_end < m_deck->size() && !isSectionDelimiter(m_deck->getKeyword(m_end)->name()))
+            m_end++;
 
-                addKeyword(keyword);
-            }
-        }
-        if (!inSection)
-            throw std::invalid_argument(std::string("Deck requires a '")+startKeywordName+"' section");
+        if (m_end < m_deck->size() && m_deck->getKeyword(m_end)->name() == startKeywordName)
+            throw std::invalid_argument(std::string("Deck contains the '")+startKeywordName+"' section multiple times");
+    }
+
+
+    /*
+      The keywords with a given name in the section; the keyword list of
+      the deck is sorted by keyword index, so the range is found with a
+      binary search.
+    */
+    std::pair<Section::const_iterator , Section::const_iterator> Section::keywordRange(const std::string& keyword) const {
+        const std::vector<DeckKeywordConstPtr>& keywordList = m_deck->getKeywordList(keyword);
+        auto indexLess = [this](const DeckKeywordConstPtr& deckKeyword , size_t index) {
+            return m_deck->getKeywordIndex(deckKeyword) < index;
+        };
+
+        auto first = std::lower_bound(keywordList.begin(), keywordList.end(), m_begin, indexLess);
+        auto last = std::lower_bound(first, keywordList.end(), m_end, indexLess);
+        return std::make_pair(first, last);
+    }
+
+
+    bool Section::hasKeyword(DeckKeywordConstPtr keyword) const {
+        if (!m_deck->hasKeyword(keyword))
+            return false;
+
+        size_t index = m_deck->getKeywordIndex(keyword);
+        return index >= m_begin && index < m_end;
+    }
+
+    bool Section::hasKeyword(const std::string& keyword) const {
+        auto range = keywordRange(keyword);
+        return range.first != range.second;
+    }
+
+    DeckKeywordConstPtr Section::getKeyword(const std::string& keyword, size_t index) const {
+        auto range = keywordRange(keyword);
+        if (range.first == range.second)
+            throw std::invalid_argument("Keyword " + keyword + " not in section " + m_name + ".");
+
+        if (index >= static_cast<size_t>(range.second - range.first))
+            throw std::out_of_range("Keyword " + keyword + ":" + std::to_string( index ) + " not in section " + m_name + ".");
+
+        return *(range.first + index);
+    }
+
+    DeckKeywordConstPtr Section::getKeyword(const std::string& keyword) const {
+        auto range = keywordRange(keyword);
+        if (range.first == range.second)
+            throw std::invalid_argument("Keyword " + keyword + " not in section " + m_name + ".");
+
+        return *(range.second - 1);
     }
 
+    DeckKeywordConstPtr Section::getKeyword(size_t index) const {
+        if (index >= size())
+            throw std::out_of_range("Keyword index " + std::to_string( index ) + " is out of range.");
+
+        return m_deck->getKeyword(m_begin + index);
+    }
+
+    size_t Section::getKeywordIndex(DeckKeywordConstPtr keyword) const {
+        if (!hasKeyword(keyword))
+            throw std::invalid_argument("Keyword " + keyword->name() + " not in section " + m_name + ".");
+
+        return m_deck->getKeywordIndex(keyword) - m_begin;
+    }
+
+    size_t Section::numKeywords(const std::string& keyword) const {
+        auto range = keywordRange(keyword);
+        return range.second - range.first;
+    }
+
+    std::vector<DeckKeywordConstPtr> Section::getKeywordList(const std::string& keyword) const {
+        auto range = keywordRange(keyword);
+        return std::vector<DeckKeywordConstPtr>(range.first, range.second);
+    }
+
+    size_t Section::size() const {
+        return m_end - m_begin;
+    }
+
+    std::shared_ptr<UnitSystem> Section::getDefaultUnitSystem() const {
+        return m_deck->getDefaultUnitSystem();
+    }
+
+    std::shared_ptr<UnitSystem> Section::getActiveUnitSystem() const {
+        return m_deck->getActiveUnitSystem();
+    }
+
+    Section::const_iterator Section::begin() const {
+        return m_deck->begin() + m_begin;
+    }
+
+    Section::const_iterator Section::end() const {
+        return m_deck->begin() + m_end;
+    }
 
     size_t Section::count(const std::string& keyword) const {
         return numKeywords( keyword );
@@ -209,20 +293,16 @@ namespace Opm {
         return deckValid;
     }
 
-    bool Section::isSectionDelimiter(const std::string& keywordName) {
-        static std::set<std::string> sectionDelimiters;
-        if (sectionDelimiters.size() == 0) {
-            sectionDelimiters.insert("RUNSPEC");
-            sectionDelimiters.insert("GRID");
-            sectionDelimiters.insert("EDIT");
-            sectionDelimiters.insert("PROPS");
-            sectionDelimiters.insert("REGIONS");
-            sectionDelimiters.insert("SOLUTION");
-            sectionDelimiters.insert("SUMMARY");
-            sectionDelimiters.insert("SCHEDULE");
-        }
+    const std::set<std::string>& Section::sectionNames() {
+        // initialized once, also when called from the include parsing threads
+        static const std::set<std::string> sectionDelimiters = {
+            "RUNSPEC", "GRID", "EDIT", "PROPS", "REGIONS", "SOLUTION", "SUMMARY", "SCHEDULE" };
 
-        return sectionDelimiters.count(keywordName) > 0;
+        return sectionDelimiters;
+    }
+
+    bool Section::isSectionDelimiter(const std::string& keywordName) {
+        return sectionNames().count(keywordName) > 0;
     }
 
     bool Section::hasSection(DeckConstPtr deck, const std::string& startKeywordName) {
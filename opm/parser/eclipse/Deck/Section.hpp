@@ -25,6 +25,9 @@
 #include <iostream>
 #include <string>
 #include <memory>
+#include <set>
+#include <utility>
+#include <vector>
 
 #include <boost/iterator/iterator_facade.hpp>
 
@@ -33,13 +36,53 @@
 
 namespace Opm {
 
-class Section : public Deck
-    {
+    /*
+      A Section is a view of the keywords [startKeyword, next section
+      keyword) of a deck; the keywords are not copied, the section only
+      holds the parent deck and the range of keyword indices.
+    */
+    class Section {
     public:
+        typedef std::vector<DeckKeywordConstPtr>::const_iterator const_iterator;
+
         Section(DeckConstPtr deck, const std::string& startKeyword);
         const std::string& name() const;
         size_t count(const std::string& keyword) const;
 
+        bool hasKeyword(DeckKeywordConstPtr keyword) const;
+        bool hasKeyword(const std::string& keyword) const;
+        DeckKeywordConstPtr getKeyword(const std::string& keyword , size_t index) const;
+        DeckKeywordConstPtr getKeyword(const std::string& keyword) const;
+        DeckKeywordConstPtr getKeyword(size_t index) const;
+        size_t getKeywordIndex(DeckKeywordConstPtr keyword) const;
+        size_t numKeywords(const std::string& keyword) const;
+        std::vector<DeckKeywordConstPtr> getKeywordList(const std::string& keyword) const;
+        size_t size() const;
+        std::shared_ptr<UnitSystem> getDefaultUnitSystem() const;
+        std::shared_ptr<UnitSystem> getActiveUnitSystem()  const;
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        template <class Keyword>
+        bool hasKeyword() const {
+            return hasKeyword( Keyword::keywordName );
+        }
+
+        template <class Keyword>
+        DeckKeywordConstPtr getKeyword(size_t index) const {
+            return getKeyword( Keyword::keywordName , index );
+        }
+
+        template <class Keyword>
+        DeckKeywordConstPtr getKeyword() const {
+            return getKeyword( Keyword::keywordName );
+        }
+
+        template <class Keyword>
+        std::vector<DeckKeywordConstPtr> getKeywordList() const {
+            return getKeywordList( Keyword::keywordName );
+        }
+
         static bool hasRUNSPEC(DeckConstPtr deck) { return hasSection( deck , "RUNSPEC" ); }
         static bool hasGRID(DeckConstPtr deck) { return hasSection( deck , "GRID" ); }
         static bool hasEDIT(DeckConstPtr deck) { return hasSection( deck , "EDIT" ); }
@@ -55,11 +98,19 @@ class Section : public Deck
         static bool checkSectionTopology(DeckConstPtr deck,
                                          bool ensureKeywordSectionAffiliation = false);
 
+        // the keywords which start a section: RUNSPEC, GRID, ... SCHEDULE
+        static const std::set<std::string>& sectionNames();
+        static bool isSectionDelimiter(const std::string& keywordName);
+
     private:
         std::string m_name;
-        static bool isSectionDelimiter(const std::string& keywordName);
+        DeckConstPtr m_deck;
+        size_t m_begin;
+        size_t m_end;
+
         static bool hasSection(DeckConstPtr deck, const std::string& startKeyword);
-        void populateSection(DeckConstPtr deck, const std::string& startKeyword);
+        void findSection(const std::string& startKeyword);
+        std::pair<const_iterator , const_iterator> keywordRange(const std::string& keyword) const;
     };
 
     typedef std::shared_ptr<Section> SectionPtr;
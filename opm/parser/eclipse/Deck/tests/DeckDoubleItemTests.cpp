@@ -24,6 +24,7 @@
 #include <boost/test/unit_test.hpp>
 #include <opm/common/utility/platform_dependent/reenable_warnings.h>
 
+#include <limits>
 #include <stdexcept>
 #include <opm/parser/eclipse/Deck/DeckIntItem.hpp>
 #include <opm/parser/eclipse/Deck/DeckDoubleItem.hpp>
@@ -202,3 +203,55 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
 
 
 
+
+
+BOOST_AUTO_TEST_CASE(ConvertToSIKeepRaw) {
+    DeckDoubleItem item("HEI");
+    std::shared_ptr<Dimension> dim1(new Dimension("Length" , 2));
+    std::shared_ptr<Dimension> dim2(new Dimension("Length" , 4 , 1));
+
+    for (size_t i=0; i < 10; i++)
+        item.push_back( i );
+    item.push_backDimension( dim1 , dim1 );
+    item.push_backDimension( dim2 , dim2 );
+    item.convertToSI( true );
+
+    BOOST_CHECK( item.hasRawData() );
+    const std::vector<double>& SIdata = item.getSIDoubleData();
+    for (size_t i=0; i < 10; i += 2) {
+        BOOST_CHECK_EQUAL( i , item.getRawDouble(i) );
+        BOOST_CHECK_EQUAL( 2*i , SIdata[i] );
+        BOOST_CHECK_EQUAL( 4*(i + 1) + 1 , SIdata[i + 1] );
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(ConvertToSIInPlace) {
+    DeckDoubleItem item("HEI");
+    std::shared_ptr<Dimension> dim(new Dimension("Length" , 100));
+
+    item.push_backMultiple( 3 , 5 );
+    item.push_backDimension( dim , dim );
+    item.convertToSI( false );
+
+    BOOST_CHECK( !item.hasRawData() );
+    BOOST_CHECK_THROW( item.getRawDouble(0) , std::logic_error );
+    BOOST_CHECK_THROW( item.getRawDoubleData() , std::logic_error );
+    BOOST_CHECK_EQUAL( 5U , item.getSIDoubleData().size() );
+    for (size_t i=0; i < 5; i++)
+        BOOST_CHECK_EQUAL( 300 , item.getSIDouble(i) );
+}
+
+
+BOOST_AUTO_TEST_CASE(ConvertToSIContextDependentIsLazy) {
+    DeckDoubleItem item("HEI");
+    std::shared_ptr<Dimension> dim(new Dimension("ContextDependent" , std::numeric_limits<double>::quiet_NaN()));
+
+    item.push_back( 1.0 );
+    item.push_backDimension( dim , dim );
+    item.convertToSI( false );
+
+    BOOST_CHECK( item.hasRawData() );
+    BOOST_CHECK_EQUAL( 1.0 , item.getRawDouble(0) );
+    BOOST_CHECK_THROW( item.getSIDouble(0) , std::logic_error );
+}
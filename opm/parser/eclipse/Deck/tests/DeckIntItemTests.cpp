@@ -160,3 +160,20 @@ BOOST_AUTO_TEST_CASE(PushBackMultiple) {
 
 
 
+
+
+BOOST_AUTO_TEST_CASE(DefaultAppliedManyValues) {
+    DeckIntItem item("HEI");
+    item.reserve( 200 );
+    for (size_t i=0; i < 200; i++) {
+        if (i % 3 == 0)
+            item.push_backDefault( 1 );
+        else
+            item.push_back( 2 );
+    }
+
+    BOOST_CHECK_EQUAL( 200U , item.size() );
+    for (size_t i=0; i < 200; i++)
+        BOOST_CHECK_EQUAL( i % 3 == 0 , item.defaultApplied(i) );
+    BOOST_CHECK_THROW( item.defaultApplied(200) , std::out_of_range );
+}
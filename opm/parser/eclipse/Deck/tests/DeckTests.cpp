@@ -227,3 +227,38 @@ BOOST_AUTO_TEST_CASE(KeywordIndexCorrect) {
 
 
 
+
+
+BOOST_AUTO_TEST_CASE(ManyKeywordNames) {
+    Deck deck;
+    deck.reserve( 2000 );
+    for (size_t index = 0; index < 2000; index++)
+        deck.addKeyword( std::make_shared<DeckKeyword>( "KW" + std::to_string( index % 1000 )));
+
+    BOOST_CHECK_EQUAL( 2000U , deck.size() );
+    for (size_t index = 0; index < 1000; index++) {
+        const std::string name = "KW" + std::to_string( index );
+        BOOST_CHECK( deck.hasKeyword( name ));
+        BOOST_CHECK_EQUAL( 2U , deck.numKeywords( name ));
+        BOOST_CHECK_EQUAL( index + 1000 , deck.getKeywordIndex( deck.getKeyword( name )));
+    }
+    BOOST_CHECK( !deck.hasKeyword( "KW1000" ));
+    BOOST_CHECK_EQUAL( 0U , deck.getKeywordList( "KW1000" ).size() );
+}
+
+
+BOOST_AUTO_TEST_CASE(KeywordInTwoDecks) {
+    Deck deck1;
+    Deck deck2;
+    DeckKeywordPtr keyword1 = DeckKeywordPtr(new DeckKeyword("TRULS1"));
+    DeckKeywordPtr keyword2 = DeckKeywordPtr(new DeckKeyword("TRULS2"));
+    deck1.addKeyword(keyword1);
+    deck1.addKeyword(keyword2);
+    deck2.addKeyword(keyword2);
+
+    BOOST_CHECK( deck1.hasKeyword( keyword2 ));
+    BOOST_CHECK( deck2.hasKeyword( keyword2 ));
+    BOOST_CHECK( !deck2.hasKeyword( keyword1 ));
+    BOOST_CHECK_EQUAL( 1U , deck1.getKeywordIndex( keyword2 ));
+    BOOST_CHECK_EQUAL( 0U , deck2.getKeywordIndex( keyword2 ));
+}
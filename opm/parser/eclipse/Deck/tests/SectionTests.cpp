@@ -469,3 +469,33 @@ BOOST_AUTO_TEST_CASE(Section_InvalidDecks) {
 
     BOOST_CHECK(!Opm::Section::checkSectionTopology(deck));
 }
+
+
+BOOST_AUTO_TEST_CASE(SectionIsViewOfDeck) {
+    DeckPtr deck(new Deck());
+    DeckKeywordPtr test0(new DeckKeyword("TEST"));
+    deck->addKeyword(test0);
+    deck->addKeyword(std::make_shared<DeckKeyword>("GRID"));
+    DeckKeywordPtr test1(new DeckKeyword("TEST"));
+    deck->addKeyword(test1);
+    DeckKeywordPtr test2(new DeckKeyword("TEST"));
+    deck->addKeyword(test2);
+    deck->addKeyword(std::make_shared<DeckKeyword>("PROPS"));
+    DeckKeywordPtr test3(new DeckKeyword("TEST"));
+    deck->addKeyword(test3);
+
+    GRIDSection section(deck);
+    BOOST_CHECK_EQUAL( 3U , section.size() );
+    BOOST_CHECK_EQUAL( 2U , section.count("TEST") );
+    BOOST_CHECK_EQUAL( 2U , section.getKeywordList("TEST").size() );
+    BOOST_CHECK_EQUAL( test1 , section.getKeyword("TEST" , 0) );
+    BOOST_CHECK_EQUAL( test2 , section.getKeyword("TEST") );
+    BOOST_CHECK_THROW( section.getKeyword("TEST" , 2) , std::out_of_range );
+    BOOST_CHECK_THROW( section.getKeyword("PROPS") , std::invalid_argument );
+
+    BOOST_CHECK( section.hasKeyword( test1 ));
+    BOOST_CHECK( !section.hasKeyword( test0 ));
+    BOOST_CHECK( !section.hasKeyword( test3 ));
+    BOOST_CHECK_EQUAL( 2U , section.getKeywordIndex( test2 ));
+    BOOST_CHECK_EQUAL( "GRID" , section.getKeyword(0)->name() );
+}
@@ -17,6 +17,8 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <math.h>
@@ -35,6 +37,7 @@
 #include <opm/parser/eclipse/Parser/ParserKeywords.hpp>
 
 #include <opm/parser/eclipse/OpmLog/OpmLog.hpp>
+#include <opm/parser/eclipse/OpmLog/ProfileLog.hpp>
 
 
 namespace Opm {
@@ -89,11 +92,12 @@ namespace Opm {
                     if (poro->containsNaN())
                         throw std::logic_error("Do not have information for the PORV keyword - some defaulted values in PORO");
                     {
+                        const std::vector<double>& cellVolumes = grid->getCellVolumes();
                         for (size_t globalIndex = 0; globalIndex < porv->getCartesianSize(); globalIndex++) {
                             if (std::isnan(porv->iget(globalIndex))) {
                                 double cell_poro = poro->iget(globalIndex);
                                 double cell_ntg = ntg->iget(globalIndex);
-                                double cell_volume = grid->getCellVolume(globalIndex);
+                                double cell_volume = cellVolumes[globalIndex];
                                 porv->iset( globalIndex , cell_poro * cell_volume * cell_ntg);
                             }
                         }
@@ -129,22 +133,43 @@ namespace Opm {
         : m_defaultRegion("FLUXNUM"),
           m_parseMode( parseMode )
     {
+        // with an active ProfileLog the time of every init step is recorded
+        ProfileLog::Timer timer( ProfileLog::getActive() , "EclipseState" );
         m_deckUnitSystem = deck->getActiveUnitSystem();
         initPhases(deck);
+        timer.lap("initPhases");
         initTables(deck);
+        timer.lap("initTables");
         initEclipseGrid(deck);
+        timer.lap("initEclipseGrid");
         initGridopts(deck);
+        timer.lap("initGridopts");
         initIOConfig(deck);
+        timer.lap("initIOConfig");
         initSchedule(deck);
+        timer.lap("initSchedule");
         initIOConfigPostSchedule(deck);
+        timer.lap("initIOConfigPostSchedule");
         initTitle(deck);
+        timer.lap("initTitle");
         initProperties(deck);
+        timer.lap("initProperties");
         initInitConfig(deck);
+        timer.lap("initInitConfig");
         initSimulationConfig(deck);
+        timer.lap("initSimulationConfig");
         initTransMult();
+        timer.lap("initTransMult");
         initFaults(deck);
+        timer.lap("initFaults");
         initMULTREGT(deck);
+        timer.lap("initMULTREGT");
         initNNC(deck);
+        timer.lap("initNNC");
+        initMINPVandPINCH();
+        timer.lap("initMINPVandPINCH");
+        initFaultMultiplierHistory();
+        timer.lap("initFaultMultiplierHistory");
     }
 
     std::shared_ptr<const UnitSystem> EclipseState::getDeckUnitSystem() const {
@@ -199,6 +224,10 @@ namespace Opm {
         return m_transMult;
     }
 
+    std::shared_ptr<const FaultMultiplierHistory> EclipseState::getFaultMultiplierHistory() const {
+        return m_faultMultiplierHistory;
+    }
+
     std::shared_ptr<const NNC> EclipseState::getNNC() const {
         return m_nnc;
     }
@@ -207,6 +236,14 @@ namespace Opm {
         return m_nnc->hasNNC();
     }
 
+    std::shared_ptr<const NNC> EclipseState::getPinchNNC() const {
+        return m_pinchNNC;
+    }
+
+    const std::vector<int>& EclipseState::getMinpvActnum() const {
+        return m_minpvActnum;
+    }
+
     std::string EclipseState::getTitle() const {
         return m_title;
     }
@@ -255,6 +292,81 @@ namespace Opm {
         m_nnc = std::make_shared<NNC>( deck, grid);
     }
 
+    /*
+      The MINPV cells are removed from the ACTNUM of the grid once here,
+      before the grid is handed out, so the active cells, the index
+      maps and the active cell output of the grid properties all agree
+      with getMinpvActnum(). The PINCH connections are kept separately.
+    */
+    void EclipseState::initMINPVandPINCH() {
+        m_pinchNNC = std::make_shared<NNC>();
+
+        std::vector<double> porv;
+        std::vector<int> actnum;
+        const bool useMinpv = (m_eclipseGrid->getMinpvMode() != MinpvMode::ModeEnum::Inactive);
+        if (useMinpv)
+            porv = getDoubleGridProperty("PORV")->getData();
+        else if (!m_eclipseGrid->isPinchActive())
+            return;
+
+        const auto connections = m_eclipseGrid->processMINPVandPINCH( porv , actnum );
+        if (useMinpv) {
+            m_eclipseGrid->resetACTNUM( actnum.data() );
+            m_minpvActnum.swap( actnum );
+        }
+
+        if (!connections.empty() && !hasDoubleGridProperty("PERMZ"))
+            OpmLog::addMessage(Log::MessageType::Warning , "No PERMZ in the deck - the PINCH connections get zero transmissibility");
+
+        for (const auto& connection : connections)
+            m_pinchNNC->addNNC( connection.first , connection.second , getPinchTransmissibility( connection.first , connection.second ));
+    }
+
+
+    /*
+      The harmonic average of the vertical half transmissibilities
+      PERMZ * A / (h / 2) of the two cells, with the horizontal area A
+      as volume / thickness. With the MULTZ option ALL the smallest
+      MULTZ of the upper cell and the cells in the gap is used,
+      otherwise the MULTZ of the upper cell. The PINCHOUT option ALL
+      is treated as TOPBOT.
+    */
+    double EclipseState::getPinchTransmissibility(size_t upperIndex , size_t lowerIndex) const {
+        if (!hasDoubleGridProperty("PERMZ"))
+            return 0;
+
+        auto permz = getDoubleGridProperty("PERMZ");
+        const std::vector<double>& volumes = m_eclipseGrid->getCellVolumes();
+        const std::vector<double>& thicknesses = m_eclipseGrid->getCellThicknesses();
+        double inverseTrans = 0;
+
+        for (size_t globalIndex : { upperIndex , lowerIndex }) {
+            const double thickness = thicknesses[globalIndex];
+            const double halfTrans = 2 * permz->iget( globalIndex ) * volumes[globalIndex] / (thickness * thickness);
+            if (!(halfTrans > 0) || std::isinf( halfTrans ))
+                return 0;
+            inverseTrans += 1 / halfTrans;
+        }
+
+        double multz = m_transMult->getMultiplier( upperIndex , FaceDir::ZPlus );
+        if (m_eclipseGrid->getMultzOption() == PinchMode::ModeEnum::ALL) {
+            const size_t layerSize = m_eclipseGrid->getNX() * m_eclipseGrid->getNY();
+            for (size_t globalIndex = upperIndex + layerSize; globalIndex < lowerIndex; globalIndex += layerSize)
+                multz = std::min( multz , m_transMult->getMultiplier( globalIndex , FaceDir::ZPlus ));
+        }
+
+        return multz / inverseTrans;
+    }
+
+
+    /*
+      Must be created before the modifier decks are applied to the
+      TransMult object.
+    */
+    void EclipseState::initFaultMultiplierHistory() {
+        m_faultMultiplierHistory = std::make_shared<FaultMultiplierHistory>( m_parseMode , m_faults , m_transMult , schedule );
+    }
+
     void EclipseState::initTransMult() {
         EclipseGridConstPtr grid = getEclipseGrid();
         m_transMult = std::make_shared<TransMult>( grid->getNX() , grid->getNY() , grid->getNZ());
@@ -315,14 +427,14 @@ namespace Opm {
         if (deck->hasKeyword("MULTREGT"))
             multregtKeywords = deck->getKeywordList("MULTREGT");
 
-        std::shared_ptr<MULTREGTScanner> scanner = std::make_shared<MULTREGTScanner>(m_intGridProperties, multregtKeywords , m_defaultRegion);
+        std::shared_ptr<MULTREGTScanner> scanner = std::make_shared<MULTREGTScanner>(m_eclipseGrid, m_intGridProperties, multregtKeywords , m_defaultRegion);
         m_transMult->setMultregtScanner( scanner );
     }
 
 
 
     void EclipseState::initEclipseGrid(DeckConstPtr deck) {
-        m_eclipseGrid = EclipseGridConstPtr( new EclipseGrid(deck));
+        m_eclipseGrid = EclipseGridPtr( new EclipseGrid(deck));
     }
 
 
@@ -900,6 +1012,12 @@ namespace Opm {
         // properties
         processGridProperties(deck, /*enabledTypes=*/IntProperties);
         processGridProperties(deck, /*enabledTypes=*/DoubleProperties);
+
+        // The region properties like SATNUM and FIPNUM usually fit in 8
+        // or 16 bits; they are expanded again by getData().
+        m_intGridProperties->compress();
+        // The region indices are only needed for the xxxREG keywords.
+        m_intGridProperties->clearRegionIndices();
     }
 
     double EclipseState::getSIScaling(const std::string &dimensionString) const
@@ -945,35 +1063,50 @@ namespace Opm {
             if (supportsGridProperty(deckKeyword->name(), enabledTypes) )
                 loadGridPropertyFromDeckKeyword(boxManager.getActiveBox(), deckKeyword,  enabledTypes);
             else {
-                if (deckKeyword->name() == "ADD")
+                switch (ParserKeywords::getKeywordId( *deckKeyword )) {
+                case ParserKeywords::ADD::keywordId:
                     handleADDKeyword(deckKeyword, boxManager, enabledTypes);
+                    break;
 
-                if (deckKeyword->name() == "BOX")
+                case ParserKeywords::BOX::keywordId:
                     handleBOXKeyword(deckKeyword, boxManager);
+                    break;
 
-                if (deckKeyword->name() == "COPY")
+                case ParserKeywords::COPY::keywordId:
                     handleCOPYKeyword(deckKeyword, boxManager, enabledTypes);
+                    break;
 
-                if (deckKeyword->name() == "EQUALS")
+                case ParserKeywords::EQUALS::keywordId:
                     handleEQUALSKeyword(deckKeyword, boxManager, enabledTypes);
+                    break;
 
-                if (deckKeyword->name() == "ENDBOX")
+                case ParserKeywords::ENDBOX::keywordId:
                     handleENDBOXKeyword(boxManager);
+                    break;
 
-                if (deckKeyword->name() == "EQUALREG")
+                case ParserKeywords::EQUALREG::keywordId:
                     handleEQUALREGKeyword(deckKeyword ,  enabledTypes);
+                    break;
 
-                if (deckKeyword->name() == "ADDREG")
+                case ParserKeywords::ADDREG::keywordId:
                     handleADDREGKeyword(deckKeyword , enabledTypes);
+                    break;
 
-                if (deckKeyword->name() == "MULTIREG")
+                case ParserKeywords::MULTIREG::keywordId:
                     handleMULTIREGKeyword(deckKeyword , enabledTypes);
+                    break;
 
-                if (deckKeyword->name() == "COPYREG")
+                case ParserKeywords::COPYREG::keywordId:
                     handleCOPYREGKeyword(deckKeyword , enabledTypes);
+                    break;
 
-                if (deckKeyword->name() == "MULTIPLY")
+                case ParserKeywords::MULTIPLY::keywordId:
                     handleMULTIPLYKeyword(deckKeyword, boxManager, enabledTypes);
+                    break;
+
+                default:
+                    break;
+                }
 
                 boxManager.endKeyword();
             }
@@ -1015,16 +1148,15 @@ namespace Opm {
                 double doubleValue = record->getItem("VALUE")->getRawDouble(0);
                 int regionValue = record->getItem("REGION_NUMBER")->getInt(0);
                 std::shared_ptr<Opm::GridProperty<int> > regionProperty = getRegion( record->getItem("REGION_NAME") );
-                std::vector<bool> mask;
-
-                regionProperty->initMask( regionValue , mask);
+                RegionIndexConstPtr regionIndex = m_intGridProperties->getRegionIndex( regionProperty->getKeywordName() );
+                const RegionIndex::Cells cells = regionIndex->getCells( regionValue );
 
                 if (m_intGridProperties->supportsKeyword( targetArray )) {
                     if (enabledTypes & IntProperties) {
                         if (isInt( doubleValue )) {
                             std::shared_ptr<Opm::GridProperty<int> > targetProperty = m_intGridProperties->getKeyword(targetArray);
                             int intValue = static_cast<int>( doubleValue + 0.5 );
-                            targetProperty->maskedSet( intValue , mask);
+                            targetProperty->regionSet( intValue , cells );
                         } else
                             throw std::invalid_argument("Fatal error processing EQUALREG keyword - expected integer value for: " + targetArray);
                     }
@@ -1034,7 +1166,7 @@ namespace Opm {
                         std::shared_ptr<Opm::GridProperty<double> > targetProperty = m_doubleGridProperties->getKeyword(targetArray);
                         const std::string& dimensionString = targetProperty->getDimensionString();
                         double SIValue = doubleValue * getSIScaling( dimensionString );
-                        targetProperty->maskedSet( SIValue , mask);
+                        targetProperty->regionSet( SIValue , cells );
                     }
                 }
                 else {
@@ -1058,16 +1190,15 @@ namespace Opm {
                 double doubleValue = record->getItem("SHIFT")->getRawDouble(0);
                 int regionValue = record->getItem("REGION_NUMBER")->getInt(0);
                 std::shared_ptr<Opm::GridProperty<int> > regionProperty = getRegion( record->getItem("REGION_NAME") );
-                std::vector<bool> mask;
-
-                regionProperty->initMask( regionValue , mask);
+                RegionIndexConstPtr regionIndex = m_intGridProperties->getRegionIndex( regionProperty->getKeywordName() );
+                const RegionIndex::Cells cells = regionIndex->getCells( regionValue );
 
                 if (m_intGridProperties->hasKeyword( targetArray )) {
                     if (enabledTypes & IntProperties) {
                         if (isInt( doubleValue )) {
                             std::shared_ptr<Opm::GridProperty<int> > targetProperty = m_intGridProperties->getKeyword(targetArray);
                             int intValue = static_cast<int>( doubleValue + 0.5 );
-                            targetProperty->maskedAdd( intValue , mask);
+                            targetProperty->regionAdd( intValue , cells );
                         } else
                             throw std::invalid_argument("Fatal error processing ADDREG keyword - expected integer value for: " + targetArray);
                     }
@@ -1077,7 +1208,7 @@ namespace Opm {
                         std::shared_ptr<Opm::GridProperty<double> > targetProperty = m_doubleGridProperties->getKeyword(targetArray);
                         const std::string& dimensionString = targetProperty->getDimensionString();
                         double SIValue = doubleValue * getSIScaling( dimensionString );
-                        targetProperty->maskedAdd( SIValue , mask);
+                        targetProperty->regionAdd( SIValue , cells );
                     }
                 }
                 else {
@@ -1103,16 +1234,15 @@ namespace Opm {
                 double doubleValue = record->getItem("FACTOR")->getRawDouble(0);
                 int regionValue = record->getItem("REGION_NUMBER")->getInt(0);
                 std::shared_ptr<Opm::GridProperty<int> > regionProperty = getRegion( record->getItem("REGION_NAME") );
-                std::vector<bool> mask;
-
-                regionProperty->initMask( regionValue , mask);
+                RegionIndexConstPtr regionIndex = m_intGridProperties->getRegionIndex( regionProperty->getKeywordName() );
+                const RegionIndex::Cells cells = regionIndex->getCells( regionValue );
 
                 if (m_intGridProperties->hasKeyword( targetArray )) {
                     if (enabledTypes & IntProperties) {
                         if (isInt( doubleValue )) {
                             std::shared_ptr<Opm::GridProperty<int> > targetProperty = m_intGridProperties->getKeyword( targetArray );
                             int intValue = static_cast<int>( doubleValue + 0.5 );
-                            targetProperty->maskedMultiply( intValue , mask);
+                            targetProperty->regionMultiply( intValue , cells );
                         } else
                             throw std::invalid_argument("Fatal error processing MULTIREG keyword - expected integer value for: " + targetArray);
                     }
@@ -1120,7 +1250,7 @@ namespace Opm {
                 else if (m_doubleGridProperties->hasKeyword( targetArray )) {
                     if (enabledTypes & DoubleProperties) {
                         std::shared_ptr<Opm::GridProperty<double> > targetProperty = m_doubleGridProperties->getKeyword(targetArray);
-                        targetProperty->maskedMultiply( doubleValue , mask);
+                        targetProperty->regionMultiply( doubleValue , cells );
                     }
                 }
                 else {
@@ -1147,22 +1277,21 @@ namespace Opm {
             if (supportsGridProperty( srcArray , enabledTypes)) {
                 int regionValue = record->getItem("REGION_NUMBER")->getInt(0);
                 std::shared_ptr<Opm::GridProperty<int> > regionProperty = getRegion( record->getItem("REGION_NAME") );
-                std::vector<bool> mask;
-
-                regionProperty->initMask( regionValue , mask );
+                RegionIndexConstPtr regionIndex = m_intGridProperties->getRegionIndex( regionProperty->getKeywordName() );
+                const RegionIndex::Cells cells = regionIndex->getCells( regionValue );
 
                 if (m_intGridProperties->hasKeyword( srcArray )) {
                     std::shared_ptr<Opm::GridProperty<int> > srcProperty = m_intGridProperties->getInitializedKeyword( srcArray );
                     if (supportsGridProperty( targetArray , IntProperties)) {
                         std::shared_ptr<Opm::GridProperty<int> > targetProperty = m_intGridProperties->getKeyword( targetArray );
-                        targetProperty->maskedCopy( *srcProperty , mask );
+                        targetProperty->regionCopy( *srcProperty , cells );
                     } else
                         throw std::invalid_argument("Fatal error processing COPYREG keyword.");
                 } else if (m_doubleGridProperties->hasKeyword( srcArray )) {
                     std::shared_ptr<Opm::GridProperty<double> > srcProperty = m_doubleGridProperties->getInitializedKeyword( srcArray );
                     if (supportsGridProperty( targetArray , DoubleProperties)) {
                         std::shared_ptr<Opm::GridProperty<double> > targetProperty = m_doubleGridProperties->getKeyword( targetArray );
-                        targetProperty->maskedCopy( *srcProperty , mask );
+                        targetProperty->regionCopy( *srcProperty , cells );
                     }
                 }
                 else {
@@ -24,6 +24,7 @@
 #include <opm/parser/eclipse/OpmLog/OpmLog.hpp>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/FaultMultiplierHistory.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/Box.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/BoxManager.hpp>
@@ -83,8 +84,15 @@ namespace Opm {
 
         std::shared_ptr<const FaultCollection> getFaults() const;
         std::shared_ptr<const TransMult> getTransMult() const;
+        // The SCHEDULE section MULTFLT per report step; an alternative to applyModifierDeck().
+        std::shared_ptr<const FaultMultiplierHistory> getFaultMultiplierHistory() const;
         std::shared_ptr<const NNC> getNNC() const;
         bool hasNNC() const;
+        // The connections across the PINCH gaps; not included in getNNC().
+        std::shared_ptr<const NNC> getPinchNNC() const;
+        // The ACTNUM with the MINPV cells made inactive, as applied to
+        // the grid of getEclipseGrid(); empty without MINPV.
+        const std::vector<int>& getMinpvActnum() const;
 
         std::shared_ptr<const TableManager> getTableManager() const;
         size_t getNumPhases() const;
@@ -111,6 +119,9 @@ namespace Opm {
         void initTransMult();
         void initFaults(DeckConstPtr deck);
         void initNNC(DeckConstPtr deck);
+        void initFaultMultiplierHistory();
+        void initMINPVandPINCH();
+        double getPinchTransmissibility(size_t upperIndex , size_t lowerIndex) const;
 
 
         void setMULTFLT(std::shared_ptr<const Section> section) const;
@@ -139,7 +150,8 @@ namespace Opm {
 
         void complainAboutAmbiguousKeyword(DeckConstPtr deck, const std::string& keywordName) const;
 
-        EclipseGridConstPtr      m_eclipseGrid;
+        // only changed by initMINPVandPINCH() while the state is built
+        EclipseGridPtr           m_eclipseGrid;
         IOConfigPtr              m_ioConfig;
         InitConfigConstPtr       m_initConfig;
         ScheduleConstPtr         schedule;
@@ -154,7 +166,10 @@ namespace Opm {
         std::shared_ptr<GridProperties<double> > m_doubleGridProperties;
         std::shared_ptr<TransMult> m_transMult;
         std::shared_ptr<FaultCollection> m_faults;
+        std::shared_ptr<const FaultMultiplierHistory> m_faultMultiplierHistory;
         std::shared_ptr<NNC> m_nnc;
+        std::shared_ptr<NNC> m_pinchNNC;
+        std::vector<int> m_minpvActnum;
         std::string m_defaultRegion;
         const ParseMode& m_parseMode;
     };
@@ -46,7 +46,7 @@ namespace Opm {
         m_stride[2] = m_dims[0] * m_dims[1];
 
         m_isGlobal = true;
-        initIndexList();
+        initIndexRuns();
     }
 
 
@@ -72,7 +72,7 @@ namespace Opm {
         else
             m_isGlobal = false;
 
-        initIndexList();
+        initIndexRuns();
     }
 
 
@@ -104,27 +104,35 @@ namespace Opm {
 
 
     const std::vector<size_t>& Box::getIndexList() const {
+        if (m_indexList.empty()) {
+            m_indexList.reserve( size() );
+            for (const auto& run : m_indexRuns) {
+                for (size_t index = run.start; index < run.start + run.length; index++)
+                    m_indexList.push_back( index );
+            }
+        }
         return m_indexList;
     }
 
 
-    void Box::initIndexList() {
-        m_indexList.resize( size() );
+    const std::vector<Box::IndexRun>& Box::getIndexRuns() const {
+        return m_indexRuns;
+    }
+
 
-        size_t ii,ij,ik;
-        size_t l = 0;
+    void Box::initIndexRuns() {
+        m_indexRuns.clear();
 
-        for (ik=0; ik < m_dims[2]; ik++) {
+        for (size_t ik = 0; ik < m_dims[2]; ik++) {
             size_t k = ik + m_offset[2];
-            for (ij=0; ij < m_dims[1]; ij++) {
+            for (size_t ij = 0; ij < m_dims[1]; ij++) {
                 size_t j = ij + m_offset[1];
-                for (ii=0; ii < m_dims[0]; ii++) {
-                    size_t i = ii + m_offset[0];
-                    size_t g = i * m_stride[0] + j*m_stride[1] + k*m_stride[2];
+                size_t start = m_offset[0] * m_stride[0] + j*m_stride[1] + k*m_stride[2];
 
-                    m_indexList[l] = g;
-                    l++;
-                }
+                if (!m_indexRuns.empty() && m_indexRuns.back().start + m_indexRuns.back().length == start)
+                    m_indexRuns.back().length += m_dims[0];
+                else
+                    m_indexRuns.push_back( IndexRun{ start , m_dims[0] } );
             }
         }
     }
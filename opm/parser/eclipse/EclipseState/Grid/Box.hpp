@@ -28,24 +28,38 @@ namespace Opm {
 
     class Box {
     public:
+        // A range of consecutive global indices, [start, start + length).
+        struct IndexRun {
+            size_t start;
+            size_t length;
+        };
+
         Box(int nx , int ny , int nz);
         Box(const Box& globalBox , int i1 , int i2 , int j1 , int j2 , int k1 , int k2); // Zero offset coordinates.
         size_t size() const;
         bool   isGlobal() const;
         size_t getDim(size_t idim) const;
+        // The global index of every cell in the box; the list is
+        // created on the first call. Prefer getIndexRuns().
         const std::vector<size_t>& getIndexList() const;
+        // The cells of the box as the fewest runs of consecutive global
+        // indices: one run per I-row, rows merged when the box spans
+        // the full I (and J) extent of the grid. Together the runs give
+        // the same indices, in the same order, as getIndexList().
+        const std::vector<IndexRun>& getIndexRuns() const;
         bool equal(const Box& other) const;
 
 
     private:
-        void initIndexList();
+        void initIndexRuns();
         static void assertDims(const Box& globalBox, size_t idim , int l1 , int l2);
         size_t m_dims[3];
         size_t m_offset[3];
         size_t m_stride[3];
 
         bool   m_isGlobal;
-        std::vector<size_t> m_indexList;
+        std::vector<IndexRun> m_indexRuns;
+        mutable std::vector<size_t> m_indexList;
     };
 }
 
@@ -0,0 +1,337 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <opm/parser/eclipse/EclipseState/Grid/CornerPointGeometry.hpp>
+
+namespace Opm {
+
+    CornerPointGeometry::CornerPointGeometry(size_t nx , size_t ny , size_t nz ,
+                                             std::shared_ptr<const std::vector<double> > coord ,
+                                             std::shared_ptr<const std::vector<double> > zcorn) :
+        m_nx( nx ),
+        m_ny( ny ),
+        m_nz( nz ),
+        m_coord( coord ),
+        m_zcorn( zcorn )
+    {
+        if (!m_coord || !m_zcorn)
+            throw std::invalid_argument("The COORD and ZCORN arrays must be given");
+
+        if (m_coord->size() != 6 * (nx + 1) * (ny + 1))
+            throw std::invalid_argument("Wrong size of COORD: " + std::to_string( m_coord->size() ) + " expected: " + std::to_string( 6 * (nx + 1) * (ny + 1) ));
+
+        if (m_zcorn->size() != 8 * nx * ny * nz)
+            throw std::invalid_argument("Wrong size of ZCORN: " + std::to_string( m_zcorn->size() ) + " expected: " + std::to_string( 8 * nx * ny * nz ));
+    }
+
+
+    size_t CornerPointGeometry::getNX() const {
+        return m_nx;
+    }
+
+
+    size_t CornerPointGeometry::getNY() const {
+        return m_ny;
+    }
+
+
+    size_t CornerPointGeometry::getNZ() const {
+        return m_nz;
+    }
+
+
+    size_t CornerPointGeometry::getCartesianSize() const {
+        return m_nx * m_ny * m_nz;
+    }
+
+
+    const std::vector<double>& CornerPointGeometry::getCOORD() const {
+        return *m_coord;
+    }
+
+
+    const std::vector<double>& CornerPointGeometry::getZCORN() const {
+        return *m_zcorn;
+    }
+
+
+    void CornerPointGeometry::assertGlobalIndex(size_t globalIndex) const {
+        if (globalIndex >= getCartesianSize())
+            throw std::invalid_argument("input index above valid range");
+    }
+
+
+    /*
+      The x and y of a corner are interpolated linearly along the
+      pillar with the z from ZCORN; a pillar with the same z at both
+      ends is vertical.
+    */
+    void CornerPointGeometry::getCellCorners(size_t globalIndex , std::array<double,8>& X , std::array<double,8>& Y , std::array<double,8>& Z) const {
+        assertGlobalIndex( globalIndex );
+
+        const size_t i = globalIndex % m_nx;
+        const size_t j = (globalIndex / m_nx) % m_ny;
+        const size_t k = globalIndex / (m_nx * m_ny);
+        const double * coord = m_coord->data();
+        const double * zcorn = m_zcorn->data();
+
+        for (size_t c = 0; c < 8; c++) {
+            const size_t di = c & 1;
+            const size_t dj = (c >> 1) & 1;
+            const size_t dk = (c >> 2) & 1;
+            const double * pillar = coord + 6 * ((j + dj) * (m_nx + 1) + i + di);
+            const double z = zcorn[((2*k + dk) * 2 * m_ny + 2*j + dj) * 2 * m_nx + 2*i + di];
+            const double height = pillar[5] - pillar[2];
+            const double t = (height == 0) ? 0 : (z - pillar[2]) / height;
+
+            X[c] = pillar[0] + t * (pillar[3] - pillar[0]);
+            Y[c] = pillar[1] + t * (pillar[4] - pillar[1]);
+            Z[c] = z;
+        }
+    }
+
+
+    std::tuple<double,double,double> CornerPointGeometry::getCellCenter(size_t globalIndex) const {
+        std::array<double,8> X , Y , Z;
+        getCellCorners( globalIndex , X , Y , Z );
+
+        double x = 0 , y = 0 , z = 0;
+        for (size_t c = 0; c < 8; c++) {
+            x += X[c];
+            y += Y[c];
+            z += Z[c];
+        }
+        return std::tuple<double,double,double> { x / 8 , y / 8 , z / 8 };
+    }
+
+
+    double CornerPointGeometry::getCellDepth(size_t globalIndex) const {
+        return std::get<2>( getCellCenter( globalIndex ));
+    }
+
+
+    double CornerPointGeometry::getCellVolume(size_t globalIndex) const {
+        std::array<double,8> X , Y , Z;
+        getCellCorners( globalIndex , X , Y , Z );
+        return cellVolume( X , Y , Z );
+    }
+
+
+    double CornerPointGeometry::getCellThickness(size_t globalIndex) const {
+        std::array<double,8> X , Y , Z;
+        getCellCorners( globalIndex , X , Y , Z );
+        return cellThickness( Z );
+    }
+
+
+    /*
+      The determinant of the Jacobian of the trilinear map from the
+      unit cube is of second degree in each of the coordinates, so the
+      2x2x2 point Gauss quadrature of it is the exact volume.
+    */
+    double CornerPointGeometry::cellVolume(const std::array<double,8>& X , const std::array<double,8>& Y , const std::array<double,8>& Z) {
+        const double gaussPoints[2] = { 0.5 - 0.5 / std::sqrt(3.0) , 0.5 + 0.5 / std::sqrt(3.0) };
+        double volume = 0;
+
+        for (size_t q = 0; q < 8; q++) {
+            const double u = gaussPoints[q & 1];
+            const double v = gaussPoints[(q >> 1) & 1];
+            const double w = gaussPoints[(q >> 2) & 1];
+            double J[3][3] = {{0 , 0 , 0} , {0 , 0 , 0} , {0 , 0 , 0}};
+
+            for (size_t c = 0; c < 8; c++) {
+                const bool di = (c & 1) != 0;
+                const bool dj = ((c >> 1) & 1) != 0;
+                const bool dk = ((c >> 2) & 1) != 0;
+                const double Nu = di ? u : 1 - u;
+                const double Nv = dj ? v : 1 - v;
+                const double Nw = dk ? w : 1 - w;
+                const double dNdu = (di ? 1 : -1) * Nv * Nw;
+                const double dNdv = (dj ? 1 : -1) * Nu * Nw;
+                const double dNdw = (dk ? 1 : -1) * Nu * Nv;
+
+                J[0][0] += dNdu * X[c]; J[0][1] += dNdu * Y[c]; J[0][2] += dNdu * Z[c];
+                J[1][0] += dNdv * X[c]; J[1][1] += dNdv * Y[c]; J[1][2] += dNdv * Z[c];
+                J[2][0] += dNdw * X[c]; J[2][1] += dNdw * Y[c]; J[2][2] += dNdw * Z[c];
+            }
+
+            volume += J[0][0] * (J[1][1] * J[2][2] - J[1][2] * J[2][1])
+                    - J[0][1] * (J[1][0] * J[2][2] - J[1][2] * J[2][0])
+                    + J[0][2] * (J[1][0] * J[2][1] - J[1][1] * J[2][0]);
+        }
+
+        return std::fabs( volume ) / 8;
+    }
+
+
+    double CornerPointGeometry::cellThickness(const std::array<double,8>& Z) {
+        double thickness = 0;
+        for (size_t c = 0; c < 4; c++)
+            thickness += Z[c + 4] - Z[c];
+        return thickness / 4;
+    }
+
+
+    /*
+      The kernel is called with ranges of consecutive cells, in
+      separate threads for large grids.
+    */
+    template <class Kernel>
+    void CornerPointGeometry::computeParallel(Kernel kernel) const {
+        const size_t numCells = getCartesianSize();
+        const size_t minCellsPerThread = 100000;
+        const size_t numThreads = std::max<size_t>( 1 , std::min<size_t>( std::thread::hardware_concurrency() , numCells / minCellsPerThread ));
+        if (numThreads == 1)
+            kernel( 0 , numCells );
+        else {
+            std::vector<std::thread> threads;
+            const size_t chunkSize = (numCells + numThreads - 1) / numThreads;
+            for (size_t begin = 0; begin < numCells; begin += chunkSize)
+                threads.push_back( std::thread( kernel , begin , std::min( begin + chunkSize , numCells )));
+
+            for (auto& thread : threads)
+                thread.join();
+        }
+    }
+
+
+    void CornerPointGeometry::computeCellGeometry(std::vector<double>& centerX , std::vector<double>& centerY , std::vector<double>& centerZ ,
+                                                  std::vector<double>& depth , std::vector<double>& volume , std::vector<double>& thickness) const {
+        const size_t numCells = getCartesianSize();
+        centerX.resize( numCells );
+        centerY.resize( numCells );
+        centerZ.resize( numCells );
+        depth.resize( numCells );
+        volume.resize( numCells );
+        thickness.resize( numCells );
+
+        computeParallel( [&](size_t begin , size_t end) {
+                std::array<double,8> X , Y , Z;
+                for (size_t g = begin; g < end; g++) {
+                    getCellCorners( g , X , Y , Z );
+
+                    double x = 0 , y = 0 , z = 0;
+                    for (size_t c = 0; c < 8; c++) {
+                        x += X[c];
+                        y += Y[c];
+                        z += Z[c];
+                    }
+                    centerX[g] = x / 8;
+                    centerY[g] = y / 8;
+                    centerZ[g] = z / 8;
+                    depth[g] = z / 8;
+                    volume[g] = cellVolume( X , Y , Z );
+                    thickness[g] = cellThickness( Z );
+                }
+            });
+    }
+
+
+    template <class CellFunction>
+    void CornerPointGeometry::computeCellValues(std::vector<double>& values , CellFunction cellFunction) const {
+        values.resize( getCartesianSize() );
+
+        computeParallel( [&](size_t begin , size_t end) {
+                std::array<double,8> X , Y , Z;
+                for (size_t g = begin; g < end; g++) {
+                    getCellCorners( g , X , Y , Z );
+                    values[g] = cellFunction( X , Y , Z );
+                }
+            });
+    }
+
+
+    void CornerPointGeometry::computeCellDepths(std::vector<double>& depth) const {
+        computeCellValues( depth , [](const std::array<double,8>& /* X */ , const std::array<double,8>& /* Y */ , const std::array<double,8>& Z) {
+                double z = 0;
+                for (size_t c = 0; c < 8; c++)
+                    z += Z[c];
+                return z / 8;
+            });
+    }
+
+
+    void CornerPointGeometry::computeCellVolumes(std::vector<double>& volume) const {
+        computeCellValues( volume , &CornerPointGeometry::cellVolume );
+    }
+
+
+    void CornerPointGeometry::computeCellThicknesses(std::vector<double>& thickness) const {
+        computeCellValues( thickness , [](const std::array<double,8>& /* X */ , const std::array<double,8>& /* Y */ , const std::array<double,8>& Z) {
+                return cellThickness( Z );
+            });
+    }
+
+
+    /*
+      The area vector of a quadrilateral face is half the cross
+      product of the diagonals, also when the face is not planar.
+    */
+    void CornerPointGeometry::computeFaceGeometry(FaceDir::DirEnum faceDir , FaceGeometry& faceGeometry) const {
+        // The corners of the face; (p2 - p0) x (p3 - p1) points out of the cell.
+        static const size_t xPlusCorners[4] = { 1 , 3 , 7 , 5 };
+        static const size_t yPlusCorners[4] = { 2 , 6 , 7 , 3 };
+        static const size_t zPlusCorners[4] = { 4 , 5 , 7 , 6 };
+        const size_t * corners;
+
+        switch (faceDir) {
+        case FaceDir::XPlus:
+            corners = xPlusCorners;
+            break;
+        case FaceDir::YPlus:
+            corners = yPlusCorners;
+            break;
+        case FaceDir::ZPlus:
+            corners = zPlusCorners;
+            break;
+        default:
+            throw std::invalid_argument("The face geometry is only available for the XPlus, YPlus and ZPlus faces");
+        }
+
+        const size_t numCells = getCartesianSize();
+        faceGeometry.area.resize( numCells );
+        faceGeometry.normalX.resize( numCells );
+        faceGeometry.normalY.resize( numCells );
+        faceGeometry.normalZ.resize( numCells );
+
+        computeParallel( [&](size_t begin , size_t end) {
+                std::array<double,8> X , Y , Z;
+                for (size_t g = begin; g < end; g++) {
+                    getCellCorners( g , X , Y , Z );
+
+                    const double d1[3] = { X[corners[2]] - X[corners[0]] , Y[corners[2]] - Y[corners[0]] , Z[corners[2]] - Z[corners[0]] };
+                    const double d2[3] = { X[corners[3]] - X[corners[1]] , Y[corners[3]] - Y[corners[1]] , Z[corners[3]] - Z[corners[1]] };
+                    const double ax = 0.5 * (d1[1] * d2[2] - d1[2] * d2[1]);
+                    const double ay = 0.5 * (d1[2] * d2[0] - d1[0] * d2[2]);
+                    const double az = 0.5 * (d1[0] * d2[1] - d1[1] * d2[0]);
+                    const double area = std::sqrt( ax * ax + ay * ay + az * az );
+
+                    faceGeometry.area[g] = area;
+                    faceGeometry.normalX[g] = (area > 0) ? ax / area : 0;
+                    faceGeometry.normalY[g] = (area > 0) ? ay / area : 0;
+                    faceGeometry.normalZ[g] = (area > 0) ? az / area : 0;
+                }
+            });
+    }
+}
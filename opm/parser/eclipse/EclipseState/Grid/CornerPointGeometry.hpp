@@ -0,0 +1,111 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef CORNERPOINTGEOMETRY_HPP_
+#define CORNERPOINTGEOMETRY_HPP_
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
+
+namespace Opm {
+
+    /*
+      The geometry of a corner point grid computed directly from the
+      COORD and ZCORN arrays in double precision.
+
+      The arrays are held by shared pointers and never copied; the
+      arrays of a deck can be passed with the aliasing constructor of
+      std::shared_ptr, which keeps the DeckKeyword alive:
+
+         std::shared_ptr<const std::vector<double> > coord( coordKeyword , &coordKeyword->getSIDoubleData() );
+
+      The corners of a cell are numbered c = di + 2*dj + 4*dk, where
+      di, dj and dk are 0 for the low and 1 for the high side of the
+      cell in the i, j and k direction. The cell center and depth are
+      the averages of the corners and the thickness is the average
+      height along the four pillars, as in ecl_grid. The volume is the
+      exact volume of the trilinear cell.
+    */
+    class CornerPointGeometry {
+    public:
+        /*
+          The area and unit normal of the XPlus, YPlus or ZPlus face of
+          every cell. The normal points towards increasing i, j or k
+          when x, y and z increase with i, j and k.
+        */
+        struct FaceGeometry {
+            std::vector<double> area;
+            std::vector<double> normalX;
+            std::vector<double> normalY;
+            std::vector<double> normalZ;
+        };
+
+        CornerPointGeometry(size_t nx , size_t ny , size_t nz ,
+                            std::shared_ptr<const std::vector<double> > coord ,
+                            std::shared_ptr<const std::vector<double> > zcorn);
+
+        size_t getNX() const;
+        size_t getNY() const;
+        size_t getNZ() const;
+        size_t getCartesianSize() const;
+        const std::vector<double>& getCOORD() const;
+        const std::vector<double>& getZCORN() const;
+
+        void getCellCorners(size_t globalIndex , std::array<double,8>& X , std::array<double,8>& Y , std::array<double,8>& Z) const;
+        std::tuple<double,double,double> getCellCenter(size_t globalIndex) const;
+        double getCellDepth(size_t globalIndex) const;
+        double getCellVolume(size_t globalIndex) const;
+        double getCellThickness(size_t globalIndex) const;
+
+        /*
+          The whole grid in one call, computed in parallel for large
+          grids; the vectors are resized to the number of cells.
+        */
+        void computeCellGeometry(std::vector<double>& centerX , std::vector<double>& centerY , std::vector<double>& centerZ ,
+                                 std::vector<double>& depth , std::vector<double>& volume , std::vector<double>& thickness) const;
+        // A single quantity of the whole grid, computed like computeCellGeometry().
+        void computeCellDepths(std::vector<double>& depth) const;
+        void computeCellVolumes(std::vector<double>& volume) const;
+        void computeCellThicknesses(std::vector<double>& thickness) const;
+        void computeFaceGeometry(FaceDir::DirEnum faceDir , FaceGeometry& faceGeometry) const;
+
+    private:
+        void assertGlobalIndex(size_t globalIndex) const;
+        template <class Kernel>
+        void computeParallel(Kernel kernel) const;
+        template <class CellFunction>
+        void computeCellValues(std::vector<double>& values , CellFunction cellFunction) const;
+
+        static double cellVolume(const std::array<double,8>& X , const std::array<double,8>& Y , const std::array<double,8>& Z);
+        static double cellThickness(const std::array<double,8>& Z);
+
+        size_t m_nx , m_ny , m_nz;
+        std::shared_ptr<const std::vector<double> > m_coord;
+        std::shared_ptr<const std::vector<double> > m_zcorn;
+    };
+
+    typedef std::shared_ptr<CornerPointGeometry> CornerPointGeometryPtr;
+    typedef std::shared_ptr<const CornerPointGeometry> CornerPointGeometryConstPtr;
+}
+
+#endif
@@ -18,7 +18,11 @@
 */
 
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <iostream>
+#include <thread>
 #include <tuple>
 #include <cmath>
 
@@ -300,8 +304,15 @@ namespace Opm {
         {
             DeckKeywordConstPtr ZCORNKeyWord = deck->getKeyword<ParserKeywords::ZCORN>();
             DeckKeywordConstPtr COORDKeyWord = deck->getKeyword<ParserKeywords::COORD>();
+            // The SI data of the keywords is created here, once; later
+            // calls to getSIDoubleData() only read it.
             const std::vector<double>& zcorn = ZCORNKeyWord->getSIDoubleData();
             const std::vector<double>& coord = COORDKeyWord->getSIDoubleData();
+
+            // The geometry uses the deck arrays directly; the aliasing pointers keep the keywords alive.
+            m_cornerPointGeometry = std::make_shared<const CornerPointGeometry>( dims[0] , dims[1] , dims[2] ,
+                                                                                 std::shared_ptr<const std::vector<double> >( COORDKeyWord , &coord ) ,
+                                                                                 std::shared_ptr<const std::vector<double> >( ZCORNKeyWord , &zcorn ));
             const int * actnum = NULL;
             double    * mapaxes = NULL;
 
@@ -598,55 +609,157 @@ namespace Opm {
     }
 
 
+    /*
+      Created from the ACTNUM of the grid with a single ecl_grid call;
+      the vectors are refilled, not replaced.
+    */
+    void EclipseGrid::initActiveIndexMap(ActiveIndexMap& indexMap) const {
+        std::vector<int> actnum( getCartesianSize() );
+        ecl_grid_init_actnum_data( c_ptr() , actnum.data() );
+
+        indexMap.globalToActive.assign( actnum.size() , -1 );
+        indexMap.activeToGlobal.clear();
+        indexMap.activeToGlobal.reserve( getNumActive() );
+        for (size_t g = 0; g < actnum.size(); g++) {
+            if (actnum[g] > 0) {
+                indexMap.globalToActive[g] = static_cast<int>( indexMap.activeToGlobal.size() );
+                indexMap.activeToGlobal.push_back( g );
+            }
+        }
+    }
+
+
+    /*
+      Concurrent first calls may both create the map; only one is
+      kept.
+    */
+    const EclipseGrid::ActiveIndexMap& EclipseGrid::getActiveIndexMap() const {
+        std::shared_ptr<ActiveIndexMap> indexMap = std::atomic_load( &m_activeIndexMap );
+        if (!indexMap) {
+            assertCellInfo();
+
+            std::shared_ptr<ActiveIndexMap> expected;
+            indexMap = std::make_shared<ActiveIndexMap>();
+            initActiveIndexMap( *indexMap );
+            if (!std::atomic_compare_exchange_strong( &m_activeIndexMap , &expected , indexMap ))
+                indexMap = expected;
+        }
+        return *indexMap;
+    }
+
+
+    const std::vector<int>& EclipseGrid::getGlobalToActive() const {
+        return getActiveIndexMap().globalToActive;
+    }
+
+
+    const std::vector<size_t>& EclipseGrid::getActiveToGlobal() const {
+        return getActiveIndexMap().activeToGlobal;
+    }
+
+
     double EclipseGrid::getCellVolume(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
-        return ecl_grid_get_cell_volume1( c_ptr() , static_cast<int>(globalIndex));
+        return getCornerPointGeometry().getCellVolume( globalIndex );
     }
 
 
     double EclipseGrid::getCellVolume(size_t i , size_t j , size_t k) const {
         assertIJK(i,j,k);
-        return ecl_grid_get_cell_volume3( c_ptr() , static_cast<int>(i),static_cast<int>(j),static_cast<int>(k));
+        return getCornerPointGeometry().getCellVolume( getGlobalIndex(i,j,k) );
     }
 
     double EclipseGrid::getCellThicknes(size_t i , size_t j , size_t k) const {
         assertIJK(i,j,k);
-        return ecl_grid_get_cell_thickness3( c_ptr() , static_cast<int>(i),static_cast<int>(j),static_cast<int>(k));
+        return getCornerPointGeometry().getCellThickness( getGlobalIndex(i,j,k) );
     }
 
     double EclipseGrid::getCellThicknes(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
-        return ecl_grid_get_cell_thickness1( c_ptr() , static_cast<int>(globalIndex));
+        return getCornerPointGeometry().getCellThickness( globalIndex );
     }
 
     std::tuple<double,double,double> EclipseGrid::getCellCenter(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
-        {
-            double x,y,z;
-            ecl_grid_get_xyz1( c_ptr() , static_cast<int>(globalIndex) , &x , &y , &z);
-            return std::tuple<double,double,double> {x,y,z};
-        }
+        return getCornerPointGeometry().getCellCenter( globalIndex );
     }
 
 
     std::tuple<double,double,double> EclipseGrid::getCellCenter(size_t i,size_t j, size_t k) const {
         assertIJK(i,j,k);
-        {
-            double x,y,z;
-            ecl_grid_get_xyz3( c_ptr() , static_cast<int>(i),static_cast<int>(j),static_cast<int>(k), &x , &y , &z);
-            return std::tuple<double,double,double> {x,y,z};
-        }
+        return getCornerPointGeometry().getCellCenter( getGlobalIndex(i,j,k) );
     }
 
     double EclipseGrid::getCellDepth(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
-        return ecl_grid_get_cdepth1( c_ptr() , static_cast<int>(globalIndex));
+        return getCornerPointGeometry().getCellDepth( globalIndex );
     }
 
 
     double EclipseGrid::getCellDepth(size_t i,size_t j, size_t k) const {
         assertIJK(i,j,k);
-        return ecl_grid_get_cdepth3( c_ptr() , static_cast<int>(i),static_cast<int>(j),static_cast<int>(k));
+        return getCornerPointGeometry().getCellDepth( getGlobalIndex(i,j,k) );
+    }
+
+
+    /*
+      Grids which are not created from COORD and ZCORN in the deck get
+      the arrays from ecl_grid on first use. Concurrent first calls may
+      both create the geometry; only one is kept.
+    */
+    const CornerPointGeometry& EclipseGrid::getCornerPointGeometry() const {
+        if (m_cornerPointGeometry)
+            return *m_cornerPointGeometry;
+
+        std::shared_ptr<const CornerPointGeometry> geometry = std::atomic_load( &m_exportedGeometry );
+        if (!geometry) {
+            assertCellInfo();
+
+            std::shared_ptr<std::vector<double> > coord = std::make_shared<std::vector<double> >( ecl_grid_get_coord_size( c_ptr() ));
+            std::shared_ptr<std::vector<double> > zcorn = std::make_shared<std::vector<double> >( ecl_grid_get_zcorn_size( c_ptr() ));
+            ecl_grid_init_coord_data_double( c_ptr() , coord->data() );
+            ecl_grid_init_zcorn_data_double( c_ptr() , zcorn->data() );
+
+            std::shared_ptr<const CornerPointGeometry> expected;
+            geometry = std::make_shared<const CornerPointGeometry>( getNX() , getNY() , getNZ() , coord , zcorn );
+            if (!std::atomic_compare_exchange_strong( &m_exportedGeometry , &expected , geometry ))
+                geometry = expected;
+        }
+        return *geometry;
+    }
+
+
+    /*
+      Concurrent first calls may both compute the array; only one
+      result is kept.
+    */
+    const std::vector<double>& EclipseGrid::getCellArray(std::shared_ptr<const std::vector<double> >& cellArray , CellArrayFunction computeCellArray) const {
+        std::shared_ptr<const std::vector<double> > values = std::atomic_load( &cellArray );
+        if (!values) {
+            std::shared_ptr<std::vector<double> > newValues = std::make_shared<std::vector<double> >();
+            (getCornerPointGeometry().*computeCellArray)( *newValues );
+
+            std::shared_ptr<const std::vector<double> > expected;
+            values = newValues;
+            if (!std::atomic_compare_exchange_strong( &cellArray , &expected , values ))
+                values = expected;
+        }
+        return *values;
+    }
+
+
+    const std::vector<double>& EclipseGrid::getCellDepths() const {
+        return getCellArray( m_cellDepths , &CornerPointGeometry::computeCellDepths );
+    }
+
+
+    const std::vector<double>& EclipseGrid::getCellVolumes() const {
+        return getCellArray( m_cellVolumes , &CornerPointGeometry::computeCellVolumes );
+    }
+
+
+    const std::vector<double>& EclipseGrid::getCellThicknesses() const {
+        return getCellArray( m_cellThicknesses , &CornerPointGeometry::computeCellThicknesses );
     }
 
 
@@ -670,14 +783,26 @@ namespace Opm {
         }
     }
 
+    /*
+      The arrays of the CornerPointGeometry are in double precision,
+      the ecl_grid only holds them as float.
+    */
     void EclipseGrid::exportCOORD( std::vector<double>& coord) const {
-        coord.resize( ecl_grid_get_coord_size( c_ptr() ));
-        ecl_grid_init_coord_data_double( c_ptr() , coord.data() );
+        if (m_cornerPointGeometry)
+            coord = m_cornerPointGeometry->getCOORD();
+        else {
+            coord.resize( ecl_grid_get_coord_size( c_ptr() ));
+            ecl_grid_init_coord_data_double( c_ptr() , coord.data() );
+        }
     }
 
     void EclipseGrid::exportZCORN( std::vector<double>& zcorn) const {
-        zcorn.resize( ecl_grid_get_zcorn_size( c_ptr() ));
-        ecl_grid_init_zcorn_data_double( c_ptr() , zcorn.data() );
+        if (m_cornerPointGeometry)
+            zcorn = m_cornerPointGeometry->getZCORN();
+        else {
+            zcorn.resize( ecl_grid_get_zcorn_size( c_ptr() ));
+            ecl_grid_init_zcorn_data_double( c_ptr() , zcorn.data() );
+        }
     }
 
 
@@ -685,6 +810,83 @@ namespace Opm {
     void EclipseGrid::resetACTNUM( const int * actnum) {
         assertCellInfo();
         ecl_grid_reset_actnum( m_grid.get() , actnum );
+
+        // Updated in place; callers may hold references to the vectors.
+        std::shared_ptr<ActiveIndexMap> indexMap = std::atomic_load( &m_activeIndexMap );
+        if (indexMap)
+            initActiveIndexMap( *indexMap );
+    }
+
+
+    /*
+      The columns are independent, so they are split in ranges which
+      are processed in separate threads for large grids; the
+      connections of the ranges are joined in column order.
+    */
+    std::vector<std::pair<size_t , size_t> > EclipseGrid::processMINPVandPINCH(const std::vector<double>& porv , std::vector<int>& actnum) const {
+        const bool useMinpv = (m_minpvMode != MinpvMode::ModeEnum::Inactive);
+        const bool usePinch = isPinchActive();
+        std::vector<std::pair<size_t , size_t> > connections;
+
+        assertCellInfo();
+        actnum.resize( getCartesianSize() );
+        ecl_grid_init_actnum_data( c_ptr() , actnum.data() );
+        if (!useMinpv && !usePinch)
+            return connections;
+
+        if (useMinpv && porv.size() != getCartesianSize())
+            throw std::invalid_argument("Size mismatch between the pore volume and the grid in processMINPVandPINCH");
+
+        const size_t layerSize = m_nx * m_ny;
+        const double threshold = usePinch ? getPinchThresholdThickness() : 0;
+        const std::vector<double>& thickness = getCellThicknesses();
+
+        auto processColumns = [&](size_t begin , size_t end , std::vector<std::pair<size_t , size_t> >& columnConnections) {
+            for (size_t column = begin; column < end; column++) {
+                bool hasUpper = false;
+                size_t upper = 0;
+                double gapThickness = 0;
+
+                for (size_t k = 0; k < m_nz; k++) {
+                    const size_t g = column + k * layerSize;
+                    if (actnum[g] <= 0)
+                        gapThickness += thickness[g];
+                    else if (useMinpv && porv[g] < m_minpvValue) {
+                        actnum[g] = 0;
+                        gapThickness += thickness[g];
+                    } else {
+                        if (usePinch && hasUpper && (g != upper + layerSize) && (gapThickness < threshold))
+                            columnConnections.push_back( std::make_pair( upper , g ));
+
+                        hasUpper = true;
+                        upper = g;
+                        gapThickness = 0;
+                    }
+                }
+            }
+        };
+
+        const size_t minCellsPerThread = 100000;
+        const size_t numThreads = std::max<size_t>( 1 , std::min<size_t>( std::thread::hardware_concurrency() , getCartesianSize() / minCellsPerThread ));
+        if (numThreads == 1)
+            processColumns( 0 , layerSize , connections );
+        else {
+            const size_t chunkSize = (layerSize + numThreads - 1) / numThreads;
+            std::vector<std::vector<std::pair<size_t , size_t> > > threadConnections( (layerSize + chunkSize - 1) / chunkSize );
+            std::vector<std::thread> threads;
+            for (size_t chunk = 0; chunk < threadConnections.size(); chunk++) {
+                const size_t begin = chunk * chunkSize;
+                threads.push_back( std::thread( processColumns , begin , std::min( begin + chunkSize , layerSize ) , std::ref( threadConnections[chunk] )));
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            for (const auto& chunkConnections : threadConnections)
+                connections.insert( connections.end() , chunkConnections.begin() , chunkConnections.end() );
+        }
+
+        return connections;
     }
 
 
@@ -28,9 +28,13 @@
 #include <opm/parser/eclipse/EclipseState/Util/Value.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/MinpvMode.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/PinchMode.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/CornerPointGeometry.hpp>
 #include <ert/ecl/ecl_grid.h>
 
 #include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace Opm {
 
@@ -62,6 +66,12 @@ namespace Opm {
 
            bool EclipseGrid::hasCellInfo();
 
+       The cell geometry - volumes, centers, depths and thicknesses -
+       is not taken from ecl_grid, but computed by a
+       CornerPointGeometry instance. For grids created from COORD and
+       ZCORN it uses the arrays of the deck and is set in the
+       constructor; for the other grids the COORD and ZCORN of the
+       ecl_grid are exported on first use.
     */
 
     class EclipseGrid {
@@ -99,15 +109,51 @@ namespace Opm {
         double getCellThicknes(size_t i , size_t j , size_t k) const;
         bool cellActive( size_t globalIndex ) const;
         bool cellActive( size_t i , size_t , size_t k ) const;
+        /*
+          The maps between global and active cell indices, created on
+          first use; the global to active map holds -1 for the inactive
+          cells. resetACTNUM() updates the vectors in place, so the
+          references stay valid.
+        */
+        const std::vector<int>& getGlobalToActive() const;
+        const std::vector<size_t>& getActiveToGlobal() const;
         double getCellDepth(size_t i,size_t j, size_t k) const;
         double getCellDepth(size_t globalIndex) const;
 
+        const CornerPointGeometry& getCornerPointGeometry() const;
+        /*
+          The depth, volume or thickness of all cells, indexed with the
+          global index. Each array is computed in parallel on its first
+          call and kept with the grid; the other arrays are not
+          computed.
+        */
+        const std::vector<double>& getCellDepths() const;
+        const std::vector<double>& getCellVolumes() const;
+        const std::vector<double>& getCellThicknesses() const;
+
 
         void exportMAPAXES( std::vector<double>& mapaxes) const;
         void exportCOORD( std::vector<double>& coord) const;
         void exportZCORN( std::vector<double>& zcorn) const;
         void exportACTNUM( std::vector<int>& actnum) const;
         void resetACTNUM( const int * actnum);
+        /*
+          Applies MINPV to ACTNUM and finds the PINCH connections in
+          one pass over the columns of the grid:
+
+            - Active cells with pore volume below the MINPV value are
+              made inactive.
+            - With PINCH two active cells in a column are connected
+              when all the cells between them are inactive and thinner
+              than the threshold in total.
+
+          porv is the pore volume of all cells and is only used with
+          MINPV. The ACTNUM of the grid with the MINPV cells made
+          inactive is written to actnum; the grid itself is not
+          changed. Returns the (upper , lower) global indices of the
+          connected cells.
+        */
+        std::vector<std::pair<size_t , size_t> > processMINPVandPINCH(const std::vector<double>& porv , std::vector<int>& actnum) const;
         bool equal(const EclipseGrid& other) const;
         void fwriteEGRID( const std::string& filename, bool output_metric ) const;
         const ecl_grid_type * c_ptr() const;
@@ -121,8 +167,25 @@ namespace Opm {
         size_t m_nx;
         size_t m_ny;
         size_t m_nz;
+        // set in the constructor and not changed, so it is read without atomic_load
+        std::shared_ptr<const CornerPointGeometry> m_cornerPointGeometry;
+        // exported from ecl_grid on first use
+        mutable std::shared_ptr<const CornerPointGeometry> m_exportedGeometry;
+        mutable std::shared_ptr<const std::vector<double> > m_cellDepths;
+        mutable std::shared_ptr<const std::vector<double> > m_cellVolumes;
+        mutable std::shared_ptr<const std::vector<double> > m_cellThicknesses;
+
+        struct ActiveIndexMap {
+            std::vector<int> globalToActive;
+            std::vector<size_t> activeToGlobal;
+        };
+        mutable std::shared_ptr<ActiveIndexMap> m_activeIndexMap;
 
         void assertCellInfo() const;
+        typedef void (CornerPointGeometry::*CellArrayFunction)(std::vector<double>&) const;
+        const std::vector<double>& getCellArray(std::shared_ptr<const std::vector<double> >& cellArray , CellArrayFunction computeCellArray) const;
+        const ActiveIndexMap& getActiveIndexMap() const;
+        void initActiveIndexMap(ActiveIndexMap& indexMap) const;
 
         void initCartesianGrid(const std::vector<int>& dims , DeckConstPtr deck);
         void initCornerPointGrid(const std::vector<int>& dims , DeckConstPtr deck);
@@ -32,8 +32,16 @@ namespace Opm {
 
 
     FaultCollection::FaultCollection( std::shared_ptr<const Deck> deck, std::shared_ptr<const EclipseGrid> grid) {
-        std::vector<std::shared_ptr<const DeckKeyword> > faultKeywords = deck->getKeywordList<ParserKeywords::FAULTS>();
+        addFaults( deck->getKeywordList<ParserKeywords::FAULTS>() , grid );
+    }
+
+
+    FaultCollection::FaultCollection( std::shared_ptr<const GRIDSection> gridSection, std::shared_ptr<const EclipseGrid> grid) {
+        addFaults( gridSection->getKeywordList<ParserKeywords::FAULTS>() , grid );
+    }
+
 
+    void FaultCollection::addFaults(const std::vector<std::shared_ptr<const DeckKeyword> >& faultKeywords , std::shared_ptr<const EclipseGrid> grid) {
         for (auto keyword_iter = faultKeywords.begin(); keyword_iter != faultKeywords.end(); ++keyword_iter) {
             std::shared_ptr<const DeckKeyword> faultsKeyword = *keyword_iter;
             for (auto iter = faultsKeyword->begin(); iter != faultsKeyword->end(); ++iter) {
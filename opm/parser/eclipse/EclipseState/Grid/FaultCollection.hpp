@@ -27,7 +27,7 @@
 
 #include <opm/parser/eclipse/EclipseState/Util/OrderedMap.hpp>
 
-#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/Section.hpp>
 
 #include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/Fault.hpp>
@@ -41,6 +41,7 @@ class FaultCollection {
 public:
     FaultCollection();
     FaultCollection( std::shared_ptr<const Deck> deck, std::shared_ptr<const EclipseGrid> grid);
+    FaultCollection( std::shared_ptr<const GRIDSection> gridSection, std::shared_ptr<const EclipseGrid> grid);
 
     size_t size() const;
     bool hasFault(const std::string& faultName) const;
@@ -50,6 +51,8 @@ public:
     void setTransMult(const std::string& faultName , double transMult);
 
 private:
+    void addFaults(const std::vector<std::shared_ptr<const DeckKeyword> >& faultKeywords , std::shared_ptr<const EclipseGrid> grid);
+
     OrderedMap<std::shared_ptr<Fault > > m_faults;
 };
 }
@@ -20,6 +20,8 @@
 #define ECLIPSE_GRIDPROPERTIES_HPP_
 
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <tuple>
@@ -27,6 +29,7 @@
 
 #include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/RegionIndex.hpp>
 
 /*
   This class implements a container (std::unordered_map<std::string ,
@@ -120,6 +123,53 @@ public:
     }
 
 
+    /*
+      See GridProperty::compress(); only worthwhile for properties
+      which are read with iget() or copyValues(), getData() expands
+      them again.
+    */
+    void compress() {
+        for (auto& property : m_property_list)
+            property->compress();
+    }
+
+
+    // The number of bytes used for the values of all the properties.
+    size_t getMemoryUsage() const {
+        size_t bytes = 0;
+        for (const auto& property : m_property_list)
+            bytes += property->getMemoryUsage();
+        return bytes;
+    }
+
+
+    /*
+      The RegionIndex of a region property, e.g. MULTNUM. The index is
+      created on the first call and kept until the property is
+      modified; only meaningful for GridProperties<int>.
+    */
+    std::shared_ptr<const RegionIndex> getRegionIndex(const std::string& keyword) {
+        auto property = getInitializedKeyword( keyword );
+        auto iter = m_regionIndices.find( keyword );
+        if (iter != m_regionIndices.end() && iter->second.first == property->getModificationCount())
+            return iter->second.second;
+
+        // read in chunks through copyValues() so a compressed property stays compressed
+        std::shared_ptr<const RegionIndex> regionIndex = std::make_shared<const RegionIndex>( property->getCartesianSize() ,
+            [&property](size_t begin , size_t end , int* target) {
+                property->copyValues( begin , end , target );
+            });
+        m_regionIndices[keyword] = std::make_pair( property->getModificationCount() , regionIndex );
+        return regionIndex;
+    }
+
+
+    // Drops the cached region indices; called when the section processing is done.
+    void clearRegionIndices() {
+        m_regionIndices.clear();
+    }
+
+
     template <class Keyword>
     bool hasKeyword() const {
         return hasKeyword( Keyword::keywordName );
@@ -142,6 +192,7 @@ private:
     std::unordered_map<std::string, SupportedKeywordInfo> m_supportedKeywords;
     std::map<std::string , std::shared_ptr<GridProperty<T> > > m_properties;
     std::vector<std::shared_ptr<GridProperty<T> > > m_property_list;
+    std::map<std::string , std::pair<size_t , std::shared_ptr<const RegionIndex> > > m_regionIndices;
 };
 
 }
@@ -40,6 +40,9 @@ bool GridProperty<int>::containsNaN( ) const {
 
 template<>
 bool GridProperty<double>::containsNaN( ) const {
+    if (m_storage == Storage::Constant)
+        return std::isnan(m_constantValue);
+
     bool return_value = false;
     size_t size = m_data.size();
     size_t index = 0;
@@ -19,8 +19,13 @@
 #ifndef ECLIPSE_GRIDPROPERTY_HPP_
 #define ECLIPSE_GRIDPROPERTY_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -32,6 +37,7 @@
 #include <opm/parser/eclipse/EclipseState/Grid/Box.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridPropertyInitializers.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/RegionIndex.hpp>
 
 /*
   This class implemenents a class representing properties which are
@@ -40,6 +46,21 @@
 
   The class is implemented as a thin wrapper around std::vector<T>;
   where the most relevant specialisations of T are 'int' and 'float'.
+
+  To save memory the values are not always held in the full vector:
+
+    1. A property created with a constant initializer only holds the
+       constant until it is modified.
+
+    2. compress() switches to the most compact representation of the
+       current values: a constant, or 8 or 16 bit values for integer
+       properties like SATNUM and FIPNUM.
+
+  iget(), copyValues() and the other const methods read all
+  representations directly. getData() expands the values to the full
+  vector under a lock, so it can be called from several threads, and
+  all modifying operations expand the values first. Once getData() has
+  returned the full vector it is kept, so the reference stays valid.
 */
 
 
@@ -159,14 +180,25 @@ public:
         m_ny = ny;
         m_nz = nz;
         m_kwInfo = kwInfo;
-        m_data.resize( nx * ny * nz );
+        m_size = nx * ny * nz;
+        m_constantValue = T();
 
-        m_kwInfo.getInitializer()->apply(m_data);
+        auto constantInitializer = std::dynamic_pointer_cast<const GridPropertyConstantInitializer<T> >( m_kwInfo.getInitializer() );
+        if (constantInitializer) {
+            m_storage = Storage::Constant;
+            m_constantValue = constantInitializer->getValue();
+        } else {
+            m_storage = Storage::Dense;
+            m_data.resize( m_size );
+            m_kwInfo.getInitializer()->apply(m_data);
+        }
+        m_dataReferenced = false;
         m_hasRunPostProcessor = false;
+        m_modificationCount = 0;
     }
 
     size_t getCartesianSize() const {
-        return m_data.size();
+        return m_size;
     }
 
     size_t getNX() const {
@@ -183,11 +215,10 @@ public:
 
 
     T iget(size_t index) const {
-        if (index < m_data.size()) {
-            return m_data[index];
-        } else {
+        if (index < m_size)
+            return getValue( index );
+        else
             throw std::invalid_argument("Index out of range \n");
-        }
     }
 
 
@@ -197,9 +228,11 @@ public:
     }
 
     void iset(size_t index, T value) {
-        if (index < m_data.size())
+        if (index < m_size) {
+            materialize();
             m_data[index] = value;
-        else
+            m_modificationCount++;
+        } else
             throw std::invalid_argument("Index out of range \n");
     }
 
@@ -214,52 +247,175 @@ public:
 
     void multiplyWith(const GridProperty<T>& other) {
         if ((m_nx == other.m_nx) && (m_ny == other.m_ny) && (m_nz == other.m_nz)) {
+            materialize();
             for (size_t g=0; g < m_data.size(); g++)
-                m_data[g] *= other.m_data[g];
+                m_data[g] *= other.getValue(g);
+            m_modificationCount++;
         } else
             throw std::invalid_argument("Size mismatch between properties in mulitplyWith.");
     }
 
 
     void multiplyValueAtIndex(size_t index, T factor) {
+        materialize();
         m_data[index] *= factor;
+        m_modificationCount++;
     }
 
     const std::vector<T>& getData() const {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        expand();
+        m_dataReferenced = true;
         return m_data;
     }
 
+    /*
+      Switch to the most compact representation of the current values;
+      the values are expanded again on the next modification or call
+      to getData(). Does nothing once getData() has returned the full
+      vector.
+    */
+    void compress() {
+        if (m_dataReferenced || m_storage != Storage::Dense || m_data.empty())
+            return;
+
+        auto minmax = std::minmax_element( m_data.begin() , m_data.end() );
+        if (std::all_of( m_data.begin() , m_data.end() , [this](const T& value) { return value == m_data[0]; } )) {
+            m_constantValue = m_data[0];
+            m_storage = Storage::Constant;
+        } else if (std::is_integral<T>::value &&
+                   *minmax.first >= std::numeric_limits<int8_t>::min() &&
+                   *minmax.second <= std::numeric_limits<int8_t>::max()) {
+            m_int8Data.resize( m_size );
+            std::transform( m_data.begin() , m_data.end() , m_int8Data.begin() , [](const T& value) { return static_cast<int8_t>( value ); } );
+            m_storage = Storage::Int8;
+        } else if (std::is_integral<T>::value &&
+                   *minmax.first >= std::numeric_limits<int16_t>::min() &&
+                   *minmax.second <= std::numeric_limits<int16_t>::max()) {
+            m_int16Data.resize( m_size );
+            std::transform( m_data.begin() , m_data.end() , m_int16Data.begin() , [](const T& value) { return static_cast<int16_t>( value ); } );
+            m_storage = Storage::Int16;
+        } else
+            return;
+
+        std::vector<T>().swap( m_data );
+    }
+
+    // Copies the values [begin, end) to target, from any representation.
+    void copyValues(size_t begin , size_t end , T* target) const {
+        switch (m_storage.load( std::memory_order_acquire )) {
+        case Storage::Constant:
+            std::fill( target , target + (end - begin) , m_constantValue );
+            break;
+        case Storage::Int8:
+            std::transform( m_int8Data.begin() + begin , m_int8Data.begin() + end , target , [](int8_t value) { return static_cast<T>( value ); } );
+            break;
+        case Storage::Int16:
+            std::transform( m_int16Data.begin() + begin , m_int16Data.begin() + end , target , [](int16_t value) { return static_cast<T>( value ); } );
+            break;
+        default:
+            std::copy( m_data.begin() + begin , m_data.begin() + end , target );
+        }
+    }
+
+    bool isCompressed() const {
+        return m_storage != Storage::Dense;
+    }
+
+    bool isConstant() const {
+        return m_storage == Storage::Constant;
+    }
+
+    // The number of bytes currently used for the values.
+    size_t getMemoryUsage() const {
+        return m_data.capacity() * sizeof(T) + m_int8Data.capacity() * sizeof(int8_t) + m_int16Data.capacity() * sizeof(int16_t);
+    }
+
+    /*
+      Incremented by every operation which changes the data; used to
+      invalidate data derived from the property, like the RegionIndex
+      cached by GridProperties.
+    */
+    size_t getModificationCount() const {
+        return m_modificationCount;
+    }
+
     
 
     void maskedSet(T value, const std::vector<bool>& mask) {
+        materialize();
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (mask[g])
                 m_data[g] = value;
         }
+        m_modificationCount++;
     }
 
 
     void maskedMultiply(T value, const std::vector<bool>& mask) {
+        materialize();
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (mask[g])
                 m_data[g] *= value;
         }
+        m_modificationCount++;
     }
 
 
     void maskedAdd(T value, const std::vector<bool>& mask) {
+        materialize();
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (mask[g])
                 m_data[g] += value;
         }
+        m_modificationCount++;
     }
 
 
     void maskedCopy(const GridProperty<T>& other, const std::vector<bool>& mask) {
+        materialize();
         for (size_t g = 0; g < getCartesianSize(); g++) {
             if (mask[g])
-                m_data[g] = other.m_data[g];
+                m_data[g] = other.getValue(g);
         }
+        m_modificationCount++;
+    }
+
+
+
+    /*
+      The region operations of the xxxREG keywords; the cells come from
+      a RegionIndex so only the cells of the region are visited.
+    */
+    void regionSet(T value, const RegionIndex::Cells& cells) {
+        materialize();
+        for (size_t g : cells)
+            m_data[g] = value;
+        m_modificationCount++;
+    }
+
+
+    void regionMultiply(T value, const RegionIndex::Cells& cells) {
+        materialize();
+        for (size_t g : cells)
+            m_data[g] *= value;
+        m_modificationCount++;
+    }
+
+
+    void regionAdd(T value, const RegionIndex::Cells& cells) {
+        materialize();
+        for (size_t g : cells)
+            m_data[g] += value;
+        m_modificationCount++;
+    }
+
+
+    void regionCopy(const GridProperty<T>& other, const RegionIndex::Cells& cells) {
+        materialize();
+        for (size_t g : cells)
+            m_data[g] = other.getValue(g);
+        m_modificationCount++;
     }
 
 
@@ -267,7 +423,7 @@ public:
     void initMask(T value, std::vector<bool>& mask) {
         mask.resize(getCartesianSize());
         for (size_t g = 0; g < getCartesianSize(); g++) {
-            if (m_data[g] == value)
+            if (iget(g) == value)
                 mask[g] = true;
             else
                 mask[g] = false;
@@ -285,10 +441,12 @@ public:
 
     void loadFromDeckKeyword(DeckKeywordConstPtr deckKeyword) {
         const auto deckItem = getDeckItem(deckKeyword);
+        materialize();
         for (size_t dataPointIdx = 0; dataPointIdx < deckItem->size(); ++dataPointIdx) {
             if (!deckItem->defaultApplied(dataPointIdx))
                 setDataPoint(dataPointIdx, dataPointIdx, deckItem);
         }
+        m_modificationCount++;
     }
 
 
@@ -298,18 +456,18 @@ public:
             loadFromDeckKeyword( deckKeyword );
         else {
             const auto deckItem = getDeckItem(deckKeyword);
-            const std::vector<size_t>& indexList = inputBox->getIndexList();
-            if (indexList.size() == deckItem->size()) {
-                for (size_t sourceIdx = 0; sourceIdx < indexList.size(); sourceIdx++) {
-                    size_t targetIdx = indexList[sourceIdx];
-                    if (sourceIdx < deckItem->size()
-                        && !deckItem->defaultApplied(sourceIdx))
-                        {
+            if (inputBox->size() == deckItem->size()) {
+                materialize();
+                size_t sourceIdx = 0;
+                for (const auto& run : inputBox->getIndexRuns()) {
+                    for (size_t targetIdx = run.start; targetIdx < run.start + run.length; targetIdx++, sourceIdx++) {
+                        if (!deckItem->defaultApplied(sourceIdx))
                             setDataPoint(sourceIdx, targetIdx, deckItem);
-                        }
+                    }
                 }
+                m_modificationCount++;
             } else {
-                std::string boxSize = std::to_string(static_cast<long long>(indexList.size()));
+                std::string boxSize = std::to_string(static_cast<long long>(inputBox->size()));
                 std::string keywordSize = std::to_string(static_cast<long long>(deckItem->size()));
 
                 throw std::invalid_argument("Size mismatch: Box:" + boxSize + "  DecKeyword:" + keywordSize);
@@ -318,60 +476,68 @@ public:
     }
 
 
+    /*
+      The box operations work on the runs of consecutive cells in the
+      box, see Box::getIndexRuns(), so the inner loops are unit stride
+      loops the compiler can vectorize; a global box is a single run.
+    */
 
     void copyFrom(const GridProperty<T>& src, std::shared_ptr<const Box> inputBox) {
-        if (inputBox->isGlobal()) {
-            for (size_t i = 0; i < src.getCartesianSize(); ++i)
-                m_data[i] = src.m_data[i];
-        } else {
-            const std::vector<size_t>& indexList = inputBox->getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] = src.m_data[targetIndex];
-            }
-        }
+        materialize();
+        for (const auto& run : inputBox->getIndexRuns())
+            src.copyValues( run.start , run.start + run.length , m_data.data() + run.start );
+        m_modificationCount++;
     }
 
     void scale(T scaleFactor , std::shared_ptr<const Box> inputBox) {
-        if (inputBox->isGlobal()) {
-            for (size_t i = 0; i < m_data.size(); ++i)
-                m_data[i] *= scaleFactor;
-        } else {
-            const std::vector<size_t>& indexList = inputBox->getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] *= scaleFactor;
-            }
+        if (m_storage == Storage::Constant && inputBox->isGlobal()) {
+            m_constantValue *= scaleFactor;
+            m_modificationCount++;
+            return;
+        }
+
+        materialize();
+        for (const auto& run : inputBox->getIndexRuns()) {
+            T* data = m_data.data() + run.start;
+            for (size_t i = 0; i < run.length; i++)
+                data[i] *= scaleFactor;
         }
+        m_modificationCount++;
     }
 
 
     void add(T shiftValue , std::shared_ptr<const Box> inputBox) {
-        if (inputBox->isGlobal()) {
-            for (size_t i = 0; i < m_data.size(); ++i)
-                m_data[i] += shiftValue;
-        } else {
-            const std::vector<size_t>& indexList = inputBox->getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] += shiftValue;
-            }
+        if (m_storage == Storage::Constant && inputBox->isGlobal()) {
+            m_constantValue += shiftValue;
+            m_modificationCount++;
+            return;
         }
+
+        materialize();
+        for (const auto& run : inputBox->getIndexRuns()) {
+            T* data = m_data.data() + run.start;
+            for (size_t i = 0; i < run.length; i++)
+                data[i] += shiftValue;
+        }
+        m_modificationCount++;
     }
 
 
 
 
     void setScalar(T value , std::shared_ptr<const Box> inputBox) {
-        if (inputBox->isGlobal()) {
-            std::fill(m_data.begin(), m_data.end(), value);
-        } else {
-            const std::vector<size_t>& indexList = inputBox->getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] = value;
-            }
+        if (inputBox->isGlobal() && !m_dataReferenced) {
+            releaseData();
+            m_storage = Storage::Constant;
+            m_constantValue = value;
+            m_modificationCount++;
+            return;
         }
+
+        materialize();
+        for (const auto& run : inputBox->getIndexRuns())
+            std::fill( m_data.begin() + run.start , m_data.begin() + run.start + run.length , value );
+        m_modificationCount++;
     }
 
     const std::string& getKeywordName() const {
@@ -399,32 +565,57 @@ public:
             // property.
             m_hasRunPostProcessor = true;
             auto postProcessor = m_kwInfo.getPostProcessor();
+            materialize();
             postProcessor->apply( m_data );
+            m_modificationCount++;
         }
     }
 
     
     ERT::EclKW<T> getEclKW() const {
         ERT::EclKW<T> eclKW( getKeywordName() , getCartesianSize());
-        eclKW.assignVector( getData() );
+        std::vector<T> values( getCartesianSize() );
+        copyValues( 0 , getCartesianSize() , values.data() );
+        eclKW.assignVector( values );
         return eclKW;
     }
 
 
     ERT::EclKW<T> getEclKW(std::shared_ptr<const EclipseGrid> grid) const {
         ERT::EclKW<T> eclKW( getKeywordName() , grid->getNumActive());
-        size_t activeIndex = 0;
-        for (size_t g = 0; g < getCartesianSize(); g++) {
-            if (grid->cellActive( g )) {
-                eclKW[activeIndex] = iget(g);
-                activeIndex++;
-            }
-        }
-        
+        eclKW.assignVector( gatherActive( grid ) );
         return eclKW;
     }
 
 
+    /*
+      Bulk conversion between the cartesian layout of the property and
+      the active cell layout, based on the index maps of the grid.
+    */
+    std::vector<T> gatherActive(std::shared_ptr<const EclipseGrid> grid) const {
+        const std::vector<size_t>& activeToGlobal = grid->getActiveToGlobal();
+        std::vector<T> activeValues( activeToGlobal.size() );
+        for (size_t activeIndex = 0; activeIndex < activeToGlobal.size(); activeIndex++)
+            activeValues[activeIndex] = getValue( activeToGlobal[activeIndex] );
+
+        return activeValues;
+    }
+
+
+    // The inactive cells are left unchanged.
+    void scatterActive(std::shared_ptr<const EclipseGrid> grid , const std::vector<T>& activeValues) {
+        const std::vector<size_t>& activeToGlobal = grid->getActiveToGlobal();
+        if (activeValues.size() != activeToGlobal.size())
+            throw std::invalid_argument("Size mismatch: " + std::to_string(activeValues.size()) + " values for "
+                                        + std::to_string(activeToGlobal.size()) + " active cells in " + getKeywordName());
+
+        materialize();
+        for (size_t activeIndex = 0; activeIndex < activeToGlobal.size(); activeIndex++)
+            m_data[activeToGlobal[activeIndex]] = activeValues[activeIndex];
+        m_modificationCount++;
+    }
+
+
 
     
     /**
@@ -432,8 +623,9 @@ public:
        interval [min,max].
     */
     void checkLimits(T min , T max) const {
-        for (size_t g=0; g < m_data.size(); g++) {
-            T value = m_data[g];
+        const size_t numValues = (m_storage == Storage::Constant) ? 1 : m_size;
+        for (size_t g=0; g < numValues; g++) {
+            T value = iget(g);
             if ((value < min) || (value > max))
                 throw std::invalid_argument("Property element outside valid limits");
         }
@@ -453,20 +645,74 @@ private:
 
         const auto deckItem = deckKeyword->getRecord(0)->getItem(0);
 
-        if (deckItem->size() > m_data.size())
+        if (deckItem->size() > m_size)
             throw std::invalid_argument("Size mismatch when setting data for:" + getKeywordName() +
                                         " keyword size: " + boost::lexical_cast<std::string>(deckItem->size())
-                                        + " input size: " + boost::lexical_cast<std::string>(m_data.size()));
+                                        + " input size: " + boost::lexical_cast<std::string>(m_size));
 
         return deckItem;
     }
 
     void setDataPoint(size_t sourceIdx, size_t targetIdx, Opm::DeckItemConstPtr deckItem);
 
+    // Reads every representation without expanding it.
+    T getValue(size_t index) const {
+        switch (m_storage.load( std::memory_order_acquire )) {
+        case Storage::Constant:
+            return m_constantValue;
+        case Storage::Int8:
+            return static_cast<T>( m_int8Data[index] );
+        case Storage::Int16:
+            return static_cast<T>( m_int16Data[index] );
+        default:
+            return m_data[index];
+        }
+    }
+
+    /*
+      Expand a constant or compressed property to the full vector; must
+      be called with m_mutex held. The compressed values are kept, a
+      concurrent iget() may still read them.
+    */
+    void expand() const {
+        if (m_storage.load( std::memory_order_acquire ) == Storage::Dense)
+            return;
+
+        m_data.resize( m_size );
+        copyValues( 0 , m_size , m_data.data() );
+        m_storage.store( Storage::Dense , std::memory_order_release );
+    }
+
+    // Expand the values before they are modified.
+    void materialize() {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        expand();
+        std::vector<int8_t>().swap( m_int8Data );
+        std::vector<int16_t>().swap( m_int16Data );
+    }
+
+    void releaseData() {
+        std::vector<T>().swap( m_data );
+        std::vector<int8_t>().swap( m_int8Data );
+        std::vector<int16_t>().swap( m_int16Data );
+    }
+
+    enum class Storage { Dense , Constant , Int8 , Int16 };
+
     size_t      m_nx,m_ny,m_nz;
+    size_t      m_size;
     SupportedKeywordInfo m_kwInfo;
-    std::vector<T> m_data;
+    // getData() may expand the values while iget() reads them; the
+    // expansion does not change the values, hence mutable.
+    mutable std::atomic<Storage> m_storage;
+    mutable std::mutex m_mutex;
+    mutable std::vector<T> m_data;
+    std::vector<int8_t> m_int8Data;
+    std::vector<int16_t> m_int16Data;
+    T m_constantValue;
+    mutable bool m_dataReferenced;
     bool m_hasRunPostProcessor;
+    size_t m_modificationCount;
 };
 
     
@@ -73,6 +73,11 @@ public:
         std::fill(values.begin(), values.end(), m_value);
     }
 
+    const ValueType& getValue() const
+    {
+        return m_value;
+    }
+
 private:
     ValueType m_value;
 };
@@ -108,11 +113,12 @@ public:
         auto eclipseGrid = m_eclipseState.getEclipseGrid();
         const TableContainer& rtempvdTables = tables->getRtempvdTables();
         const std::vector<int>& eqlNum = m_eclipseState.getIntGridProperty("EQLNUM")->getData();
+        const std::vector<double>& cellDepths = eclipseGrid->getCellDepths();
 
         for (size_t cellIdx = 0; cellIdx < eqlNum.size(); ++ cellIdx) {
             int cellEquilNum = eqlNum[cellIdx];
             const RtempvdTable& rtempvdTable = rtempvdTables.getTable<RtempvdTable>(cellEquilNum);
-            double cellDepth = std::get<2>(eclipseGrid->getCellCenter(cellIdx));
+            double cellDepth = cellDepths[cellIdx];
             values[cellIdx] = rtempvdTable.evaluate("Temperature", cellDepth);
         }
     }
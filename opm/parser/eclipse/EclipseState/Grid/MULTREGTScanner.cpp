@@ -17,9 +17,12 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <cstdlib>
 #include <stdexcept>
 #include <map>
 #include <set>
+#include <thread>
 
 #include <opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
@@ -121,9 +124,17 @@ namespace Opm {
 
       Then it will go through the different regions and looking for
       interface with the wanted region values.
+
+      Finally the search map of every region property is compiled to a
+      dense table over the region values used in the records, so the
+      lookup for a pair of cells is a few array reads per region
+      property.
     */
-    MULTREGTScanner::MULTREGTScanner(std::shared_ptr<GridProperties<int> > cellRegionNumbers, const std::vector<DeckKeywordConstPtr>& keywords , const std::string& defaultRegion ) :
-        m_cellRegionNumbers(cellRegionNumbers) {
+    MULTREGTScanner::MULTREGTScanner(std::shared_ptr<const EclipseGrid> grid, std::shared_ptr<GridProperties<int> > cellRegionNumbers, const std::vector<DeckKeywordConstPtr>& keywords , const std::string& defaultRegion ) :
+        m_cellRegionNumbers(cellRegionNumbers),
+        m_nx(grid->getNX()),
+        m_ny(grid->getNY()),
+        m_nz(grid->getNZ()) {
 
         for (size_t idx = 0; idx < keywords.size(); idx++)
             addKeyword(keywords[idx] , defaultRegion);
@@ -155,7 +166,70 @@ namespace Opm {
             m_searchMap[keyword][pair] = record;
         }
 
+        // Bounds on the number of slots and table entries per region property.
+        const long long maxRegionRange = 1 << 20;
+        const size_t maxTableSize = 1 << 20;
+        for (const auto& keywordMap : m_searchMap) {
+            RegionLookup lookup;
+            lookup.region = cellRegionNumbers->getKeyword( keywordMap.first );
+            lookup.searchMap = &keywordMap.second;
+            lookup.minRegion = 0;
+            lookup.numSlots = 0;
+
+            std::set<int> regionIds;
+            for (const auto& pairRecord : keywordMap.second) {
+                regionIds.insert( pairRecord.first.first );
+                regionIds.insert( pairRecord.first.second );
+            }
+
+            const long long regionRange = static_cast<long long>(*regionIds.rbegin()) - *regionIds.begin() + 1;
+            if (regionRange <= maxRegionRange && regionIds.size() * regionIds.size() <= maxTableSize) {
+                lookup.minRegion = *regionIds.begin();
+                lookup.slots.assign( static_cast<size_t>(regionRange) , -1 );
+                for (int regionId : regionIds)
+                    lookup.slots[regionId - lookup.minRegion] = static_cast<int>( lookup.numSlots++ );
+
+                lookup.table.resize( lookup.numSlots * lookup.numSlots , nullptr );
+                for (const auto& pairRecord : keywordMap.second) {
+                    const size_t slot1 = lookup.getSlot( pairRecord.first.first );
+                    const size_t slot2 = lookup.getSlot( pairRecord.first.second );
+                    lookup.table[slot1 * lookup.numSlots + slot2] = pairRecord.second;
+                }
+            }
+
+            m_regionLookups.push_back( lookup );
+        }
+    }
+
 
+    // The slot of a region value, or -1 when the value is not used in the records.
+    int MULTREGTScanner::RegionLookup::getSlot(int regionId) const {
+        if (regionId < minRegion)
+            return -1;
+
+        const size_t offset = static_cast<size_t>( static_cast<long long>(regionId) - minRegion );
+        if (offset >= slots.size())
+            return -1;
+
+        return slots[offset];
+    }
+
+
+    const MULTREGTRecord * MULTREGTScanner::RegionLookup::find(int regionId1 , int regionId2) const {
+        if (numSlots > 0) {
+            const int slot1 = getSlot( regionId1 );
+            const int slot2 = getSlot( regionId2 );
+            if (slot1 < 0 || slot2 < 0)
+                return nullptr;
+
+            return table[slot1 * numSlots + slot2];
+        }
+
+        auto iter = searchMap->find( std::pair<int,int>{ regionId1 , regionId2 } );
+        if (iter == searchMap->end())
+            return nullptr;
+        else
+            return iter->second;
     }
 
 
@@ -227,44 +301,77 @@ namespace Opm {
     */
     double MULTREGTScanner::getRegionMultiplier(size_t globalIndex1 , size_t globalIndex2, FaceDir::DirEnum faceDir) const {
 
-        for (auto iter = m_searchMap.begin(); iter != m_searchMap.end(); iter++) {
-            std::shared_ptr<Opm::GridProperty<int> > region = m_cellRegionNumbers->getKeyword( (*iter).first );
-            MULTREGTSearchMap map = (*iter).second;
-
-            int regionId1 = region->iget(globalIndex1);
-            int regionId2 = region->iget(globalIndex2);
+        for (const auto& lookup : m_regionLookups) {
+            int regionId1 = lookup.region->iget(globalIndex1);
+            int regionId2 = lookup.region->iget(globalIndex2);
 
-
-            std::pair<int,int> pair{regionId1 , regionId2};
-            if (map.count(pair) != 1 || !(map.at(pair)->m_directions & faceDir)) {
-                pair = std::pair<int,int>{regionId2 , regionId1};
-                if (map.count(pair) != 1 || !(map.at(pair)->m_directions & faceDir))
+            const MULTREGTRecord * record = lookup.find( regionId1 , regionId2 );
+            if (!record || !(record->m_directions & faceDir)) {
+                record = lookup.find( regionId2 , regionId1 );
+                if (!record || !(record->m_directions & faceDir))
                     continue;
             }
-            const MULTREGTRecord * record = map[pair];
-
-            bool applyMultiplier = true;
-            int i1 = globalIndex1%region->getNX();
-            int i2 = globalIndex2%region->getNX();
-            int j1 = globalIndex1/region->getNX()%region->getNY();
-            int j2 = globalIndex2/region->getNX()%region->getNY();
-
-            if (record->m_nncBehaviour == MULTREGT::NNC){
-                applyMultiplier = true;
-                if ((std::abs(i1-i2) == 0 && std::abs(j1-j2) == 1) || (std::abs(i1-i2) == 1 && std::abs(j1-j2) == 0))
-                    applyMultiplier = false;
-            }
-            else if (record->m_nncBehaviour == MULTREGT::NONNC){
-                applyMultiplier = false;
-                if ((std::abs(i1-i2) == 0 && std::abs(j1-j2) == 1) || (std::abs(i1-i2) == 1 && std::abs(j1-j2) == 0))
-                    applyMultiplier = true;
-            }
 
-            if (applyMultiplier) {
+            if (applyMultiplier( record , globalIndex1 , globalIndex2 ))
                 return record->m_transMultiplier;
-            }
-
         }
         return 1;
     }
+
+
+    bool MULTREGTScanner::applyMultiplier(const MULTREGTRecord * record , size_t globalIndex1 , size_t globalIndex2) const {
+        if (record->m_nncBehaviour != MULTREGT::NNC && record->m_nncBehaviour != MULTREGT::NONNC)
+            return true;
+
+        int i1 = globalIndex1%m_nx;
+        int i2 = globalIndex2%m_nx;
+        int j1 = globalIndex1/m_nx%m_ny;
+        int j2 = globalIndex2/m_nx%m_ny;
+        bool neighbours = (std::abs(i1-i2) == 0 && std::abs(j1-j2) == 1) || (std::abs(i1-i2) == 1 && std::abs(j1-j2) == 0);
+
+        if (record->m_nncBehaviour == MULTREGT::NNC)
+            return !neighbours;
+        else
+            return neighbours;
+    }
+
+
+    void MULTREGTScanner::getRegionMultipliers(FaceDir::DirEnum faceDir , std::vector<double>& multipliers) const {
+        if (faceDir != FaceDir::XPlus && faceDir != FaceDir::YPlus && faceDir != FaceDir::ZPlus)
+            throw std::invalid_argument("The region multipliers are only available for the XPlus, YPlus and ZPlus faces");
+
+        const size_t numCells = m_nx * m_ny * m_nz;
+        multipliers.assign( numCells , 1.0 );
+        if (m_regionLookups.empty())
+            return;
+
+        auto computeRange = [this, faceDir, &multipliers](size_t begin , size_t end) {
+            for (size_t g = begin; g < end; g++) {
+                const size_t i = g % m_nx;
+                const size_t j = g / m_nx % m_ny;
+                const size_t k = g / (m_nx * m_ny);
+
+                if (faceDir == FaceDir::XPlus && i + 1 < m_nx)
+                    multipliers[g] = getRegionMultiplier( g , g + 1 , faceDir );
+                else if (faceDir == FaceDir::YPlus && j + 1 < m_ny)
+                    multipliers[g] = getRegionMultiplier( g , g + m_nx , faceDir );
+                else if (faceDir == FaceDir::ZPlus && k + 1 < m_nz)
+                    multipliers[g] = getRegionMultiplier( g , g + m_nx * m_ny , faceDir );
+            }
+        };
+
+        const size_t minCellsPerThread = 100000;
+        const size_t numThreads = std::max<size_t>( 1 , std::min<size_t>( std::thread::hardware_concurrency() , numCells / minCellsPerThread ));
+        if (numThreads == 1)
+            computeRange( 0 , numCells );
+        else {
+            std::vector<std::thread> threads;
+            const size_t chunkSize = (numCells + numThreads - 1) / numThreads;
+            for (size_t begin = 0; begin < numCells; begin += chunkSize)
+                threads.push_back( std::thread( computeRange , begin , std::min( begin + chunkSize , numCells )));
+
+            for (auto& thread : threads)
+                thread.join();
+        }
+    }
 }
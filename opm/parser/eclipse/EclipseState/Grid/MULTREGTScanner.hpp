@@ -66,15 +66,49 @@ namespace Opm {
     class MULTREGTScanner {
 
     public:
-        MULTREGTScanner(std::shared_ptr<GridProperties<int> > cellRegionNumbers, const std::vector<DeckKeywordConstPtr>& keywords, const std::string& defaultRegion);
+        MULTREGTScanner(std::shared_ptr<const EclipseGrid> grid, std::shared_ptr<GridProperties<int> > cellRegionNumbers, const std::vector<DeckKeywordConstPtr>& keywords, const std::string& defaultRegion);
         double getRegionMultiplier(size_t globalCellIdx1, size_t globalCellIdx2, FaceDir::DirEnum faceDir) const;
+        /*
+          The multipliers of all the faces in one of the directions
+          XPlus, YPlus or ZPlus: element g is the multiplier between
+          cell g and its neighbour in the positive direction, i.e. the
+          value of getRegionMultiplier(g , neighbour , faceDir). Cells
+          on the boundary get 1.0. Large grids are evaluated in
+          parallel.
+        */
+        void getRegionMultipliers(FaceDir::DirEnum faceDir , std::vector<double>& multipliers) const;
 
     private:
+        /*
+          The records of one region property compiled to a table. The
+          region values used in the records are numbered 0..n-1 through
+          the slots vector, indexed by region value - minRegion, and
+          the table holds the n x n slot pairs. When the range of the
+          region values or the table would be too large the search map
+          is used.
+        */
+        struct RegionLookup {
+            std::shared_ptr<const GridProperty<int> > region;
+            const MULTREGTSearchMap * searchMap;
+            int minRegion;
+            std::vector<int> slots;
+            size_t numSlots;
+            std::vector<const MULTREGTRecord *> table;
+
+            const MULTREGTRecord * find(int regionId1 , int regionId2) const;
+            int getSlot(int regionId) const;
+        };
+
+        bool applyMultiplier(const MULTREGTRecord * record , size_t globalIndex1 , size_t globalIndex2) const;
         void addKeyword(DeckKeywordConstPtr deckKeyword , const std::string& defaultRegion);
         void assertKeywordSupported(DeckKeywordConstPtr deckKeyword , const std::string& defaultRegion);
         std::vector< MULTREGTRecord > m_records;
         std::map<std::string , MULTREGTSearchMap> m_searchMap;
         std::shared_ptr<GridProperties<int> > m_cellRegionNumbers;
+        std::vector<RegionLookup> m_regionLookups;
+        size_t m_nx;
+        size_t m_ny;
+        size_t m_nz;
     };
 
 }
@@ -24,6 +24,10 @@
 
 namespace Opm
 {
+    NNC::NNC()
+    {
+    }
+
     NNC::NNC(Opm::DeckConstPtr deck, EclipseGridConstPtr eclipseGrid)
     {
         const std::vector<DeckKeywordConstPtr>& nncs = deck->getKeywordList<ParserKeywords::NNC>();
@@ -29,6 +29,8 @@ namespace Opm
 class NNC
 {
 public:
+    /// Construct without connections.
+    NNC();
     /// Construct from input deck.
     NNC(Opm::DeckConstPtr deck, EclipseGridConstPtr eclipseGrid);
     void addNNC(const size_t NNC1, const size_t NNC2, const double trans);
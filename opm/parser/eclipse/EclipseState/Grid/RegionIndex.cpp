@@ -0,0 +1,153 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <opm/parser/eclipse/EclipseState/Grid/RegionIndex.hpp>
+
+namespace Opm {
+
+    RegionIndex::RegionIndex(const std::vector<int>& regionValues) :
+        RegionIndex( regionValues.size() , [&regionValues](size_t begin , size_t end , int* target) {
+                std::copy( regionValues.begin() + begin , regionValues.begin() + end , target );
+            })
+    {
+    }
+
+
+    RegionIndex::RegionIndex(size_t numCells , const ValueReader& readValues) :
+        m_minValue( 0 ),
+        m_maxValue( -1 )
+    {
+        if (numCells == 0) {
+            m_offsets.push_back( 0 );
+            return;
+        }
+
+        if (numCells > std::numeric_limits<uint32_t>::max())
+            throw std::invalid_argument("RegionIndex: " + std::to_string( numCells ) + " cells do not fit in 32 bit cell indices");
+
+        m_minValue = std::numeric_limits<int>::max();
+        m_maxValue = std::numeric_limits<int>::min();
+        forEachChunk( numCells , readValues , [this](size_t , const std::vector<int>& chunk) {
+                auto minmax = std::minmax_element( chunk.begin() , chunk.end() );
+                m_minValue = std::min( m_minValue , *minmax.first );
+                m_maxValue = std::max( m_maxValue , *minmax.second );
+            });
+
+        const long long span = static_cast<long long>(m_maxValue) - m_minValue + 1;
+        if (span > static_cast<long long>( std::max<size_t>( numCells , 1 << 16 ))) {
+            // Only the distinct values of each chunk are merged in.
+            std::vector<int> distinct;
+            std::vector<int> merged;
+            forEachChunk( numCells , readValues , [this , &distinct , &merged](size_t , const std::vector<int>& chunk) {
+                    distinct = chunk;
+                    std::sort( distinct.begin() , distinct.end() );
+                    distinct.erase( std::unique( distinct.begin() , distinct.end() ) , distinct.end() );
+                    merged.clear();
+                    std::set_union( m_regionValues.begin() , m_regionValues.end() , distinct.begin() , distinct.end() , std::back_inserter( merged ));
+                    m_regionValues.swap( merged );
+                });
+            m_offsets.resize( m_regionValues.size() + 1 , 0 );
+        } else
+            m_offsets.resize( static_cast<size_t>( span ) + 1 , 0 );
+
+        /*
+          Counting sort; the cells of a region come out in increasing
+          order. The slots are looked up again in the second pass
+          instead of being stored for every cell. While the cells are
+          placed m_offsets[s] is the next position of slot s, which
+          ends up as the start of slot s + 1.
+        */
+        forEachChunk( numCells , readValues , [this](size_t , const std::vector<int>& chunk) {
+                for (int value : chunk)
+                    m_offsets[slot( value ) + 1]++;
+            });
+
+        for (size_t s = 1; s < m_offsets.size(); s++)
+            m_offsets[s] += m_offsets[s - 1];
+
+        m_cells.resize( numCells );
+        forEachChunk( numCells , readValues , [this](size_t begin , const std::vector<int>& chunk) {
+                for (size_t index = 0; index < chunk.size(); index++)
+                    m_cells[m_offsets[slot( chunk[index] )]++] = static_cast<uint32_t>( begin + index );
+            });
+
+        for (size_t s = m_offsets.size() - 1; s > 0; s--)
+            m_offsets[s] = m_offsets[s - 1];
+        m_offsets[0] = 0;
+    }
+
+
+    void RegionIndex::forEachChunk(size_t numCells , const ValueReader& readValues , const std::function<void(size_t begin , const std::vector<int>& chunk)>& process) const {
+        const size_t chunkSize = 1 << 16;
+        std::vector<int> chunk;
+        for (size_t begin = 0; begin < numCells; begin += chunkSize) {
+            const size_t end = std::min( numCells , begin + chunkSize );
+            chunk.resize( end - begin );
+            readValues( begin , end , chunk.data() );
+            process( begin , chunk );
+        }
+    }
+
+
+    size_t RegionIndex::slot(int regionValue) const {
+        const size_t numSlots = m_offsets.size() - 1;
+        if (regionValue < m_minValue || regionValue > m_maxValue)
+            return numSlots;
+
+        if (m_regionValues.empty())
+            return static_cast<size_t>( static_cast<long long>(regionValue) - m_minValue );
+
+        auto iter = std::lower_bound( m_regionValues.begin() , m_regionValues.end() , regionValue );
+        if (iter == m_regionValues.end() || *iter != regionValue)
+            return numSlots;
+        else
+            return static_cast<size_t>( iter - m_regionValues.begin() );
+    }
+
+
+    bool RegionIndex::hasRegion(int regionValue) const {
+        return getCells( regionValue ).size() > 0;
+    }
+
+
+    RegionIndex::Cells RegionIndex::getCells(int regionValue) const {
+        const size_t s = slot( regionValue );
+        if (s == m_offsets.size() - 1)
+            return Cells{ nullptr , nullptr };
+
+        const uint32_t* cells = m_cells.data();
+        return Cells{ cells + m_offsets[s] , cells + m_offsets[s + 1] };
+    }
+
+
+    std::vector<int> RegionIndex::getRegions() const {
+        std::vector<int> regions;
+        for (size_t s = 0; s + 1 < m_offsets.size(); s++) {
+            if (m_offsets[s + 1] > m_offsets[s])
+                regions.push_back( m_regionValues.empty() ? m_minValue + static_cast<int>(s) : m_regionValues[s] );
+        }
+        return regions;
+    }
+}
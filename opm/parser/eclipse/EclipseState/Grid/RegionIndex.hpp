@@ -0,0 +1,87 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef REGIONINDEX_HPP_
+#define REGIONINDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Opm {
+
+    /*
+      The cells of every region of a region property (MULTNUM,
+      FLUXNUM, OPERNUM, ...) in compressed row form: the global indices
+      of all cells are sorted by region value, and an offset table
+      gives the range of each region. The xxxREG keywords use this to
+      touch only the cells of the region in question instead of
+      building a mask over the whole grid for every record. The cell
+      indices are stored as 32 bit values, half the memory of size_t;
+      a grid with more cells is rejected with std::invalid_argument.
+      The region values are read in chunks, so apart from the index
+      itself only one chunk of values is held during construction.
+    */
+    class RegionIndex {
+    public:
+        // The global indices, in increasing order, of the cells in one region.
+        struct Cells {
+            const uint32_t* first;
+            const uint32_t* last;
+
+            const uint32_t* begin() const { return first; }
+            const uint32_t* end() const { return last; }
+            size_t size() const { return static_cast<size_t>(last - first); }
+        };
+
+        // Copies the region values of the cells [begin, end) to target.
+        typedef std::function<void(size_t begin , size_t end , int* target)> ValueReader;
+
+        RegionIndex(size_t numCells , const ValueReader& readValues);
+        explicit RegionIndex(const std::vector<int>& regionValues);
+
+        bool hasRegion(int regionValue) const;
+        // Empty for a region value which is not present.
+        Cells getCells(int regionValue) const;
+        // The region values which are present, in increasing order.
+        std::vector<int> getRegions() const;
+
+    private:
+        size_t slot(int regionValue) const;
+        void forEachChunk(size_t numCells , const ValueReader& readValues , const std::function<void(size_t begin , const std::vector<int>& chunk)>& process) const;
+
+        /*
+          With a moderate spread of region values the slot of a value
+          is value - m_minValue; otherwise m_regionValues holds the
+          sorted distinct values and the slot is found by bisection.
+        */
+        int m_minValue;
+        int m_maxValue;
+        std::vector<int> m_regionValues;
+        std::vector<size_t> m_offsets;
+        std::vector<uint32_t> m_cells;
+    };
+
+    typedef std::shared_ptr<RegionIndex> RegionIndexPtr;
+    typedef std::shared_ptr<const RegionIndex> RegionIndexConstPtr;
+}
+
+
+#endif
@@ -562,10 +562,11 @@ public:
         // assign a NaN in this case...
         bool useEnptvd = this->m_deck.hasKeyword("ENPTVD");
         const auto& enptvdTables = tables->getEnptvdTables();
+        const std::vector<double>& cellDepths = eclipseGrid->getCellDepths();
         for (size_t cellIdx = 0; cellIdx < eclipseGrid->getCartesianSize(); cellIdx++) {
             int satTableIdx = satnum->iget( cellIdx ) - 1;
             int endNum = endnum->iget( cellIdx ) - 1;
-            double cellDepth = std::get<2>(eclipseGrid->getCellCenter(cellIdx));
+            double cellDepth = cellDepths[cellIdx];
 
 
             values[cellIdx] = this->selectValue(enptvdTables,
@@ -617,10 +618,11 @@ public:
         // assign a NaN in this case...
         bool useImptvd = this->m_deck.hasKeyword("IMPTVD");
         const TableContainer& imptvdTables = tables->getImptvdTables();
+        const std::vector<double>& cellDepths = eclipseGrid->getCellDepths();
         for (size_t cellIdx = 0; cellIdx < eclipseGrid->getCartesianSize(); cellIdx++) {
             int imbTableIdx = imbnum->iget( cellIdx ) - 1;
             int endNum = endnum->iget( cellIdx ) - 1;
-            double cellDepth = std::get<2>(eclipseGrid->getCellCenter(cellIdx));
+            double cellDepth = cellDepths[cellIdx];
 
             values[cellIdx] = this->selectValue(imptvdTables,
                                                 (useImptvd && endNum >= 0) ? endNum : -1,
@@ -16,6 +16,7 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <atomic>
 #include <stdexcept>
 #include <iostream>
 
@@ -58,14 +59,43 @@ namespace Opm {
     }
 
     double TransMult::getMultiplier__(size_t globalIndex,  FaceDir::DirEnum faceDir) const {
-        if (hasDirectionProperty( faceDir )) {
-            std::shared_ptr<const GridProperty<double> > property = m_trans.at(faceDir);
+        const auto& property = m_trans[faceIndex( faceDir )];
+        if (property)
             return property->iget( globalIndex );
-        } else
+        else
             return 1.0;
     }
 
 
+    size_t TransMult::faceIndex(FaceDir::DirEnum faceDir) {
+        switch (faceDir) {
+        case FaceDir::XPlus:
+            return 0;
+        case FaceDir::XMinus:
+            return 1;
+        case FaceDir::YPlus:
+            return 2;
+        case FaceDir::YMinus:
+            return 3;
+        case FaceDir::ZPlus:
+            return 4;
+        case FaceDir::ZMinus:
+            return 5;
+        default:
+            throw std::invalid_argument("Invalid face direction");
+        }
+    }
+
+
+    size_t TransMult::dimension(FaceDir::DirEnum faceDir) {
+        return faceIndex( faceDir ) / 2;
+    }
+
+
+    FaceDir::DirEnum TransMult::plusDirection(size_t dimension) {
+        const FaceDir::DirEnum plusDirs[3] = { FaceDir::XPlus , FaceDir::YPlus , FaceDir::ZPlus };
+        return plusDirs[dimension];
+    }
 
 
     double TransMult::getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const {
@@ -77,37 +107,46 @@ namespace Opm {
             return m_multregtScanner->getRegionMultiplier(globalCellIndex1, globalCellIndex2, faceDir);
     }
 
+    void TransMult::getRegionMultipliers(FaceDir::DirEnum faceDir , std::vector<double>& multipliers) const {
+        if (m_multregtScanner)
+            m_multregtScanner->getRegionMultipliers( faceDir , multipliers );
+        else
+            multipliers.assign( m_nx * m_ny * m_nz , 1.0 );
+    }
+
 
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
-        if (m_trans.count(faceDir) == 1)
-            return true;
-        else
-            return false;
+        return static_cast<bool>( m_trans[faceIndex( faceDir )] );
     }
 
     void TransMult::insertNewProperty(FaceDir::DirEnum faceDir) {
         GridPropertySupportedKeywordInfo<double> kwInfo(m_names[faceDir] , 1.0 , "1");
-        std::shared_ptr<GridProperty<double> > property = std::make_shared<GridProperty<double> >( m_nx , m_ny , m_nz , kwInfo );
-        std::pair<FaceDir::DirEnum , std::shared_ptr<GridProperty<double> > > pair(faceDir , property);
-
-        m_trans.insert( pair );
+        m_trans[faceIndex( faceDir )] = std::make_shared<GridProperty<double> >( m_nx , m_ny , m_nz , kwInfo );
     }
 
 
-    std::shared_ptr<GridProperty<double> > TransMult::getDirectionProperty(FaceDir::DirEnum faceDir) {
-        if (m_trans.count(faceDir) == 0)
+    std::shared_ptr<GridProperty<double> > TransMult::directionProperty(FaceDir::DirEnum faceDir) {
+        if (!hasDirectionProperty( faceDir ))
             insertNewProperty(faceDir);
 
-        return m_trans.at( faceDir );
+        return m_trans[faceIndex( faceDir )];
+    }
+
+
+    /*
+      The property can be modified through the returned pointer, so
+      the combined face multipliers must be computed again.
+    */
+    std::shared_ptr<GridProperty<double> > TransMult::getDirectionProperty(FaceDir::DirEnum faceDir) {
+        clearFaceMultipliers();
+        return directionProperty( faceDir );
     }
 
     void TransMult::applyMULT(std::shared_ptr<const GridProperty<double> > srcProp, FaceDir::DirEnum faceDir)
     {
-        std::shared_ptr<GridProperty<double> > dstProp = getDirectionProperty(faceDir);
-
-        const std::vector<double> &srcData = srcProp->getData();
-        for (size_t i = 0; i < srcData.size(); ++i)
-            dstProp->multiplyValueAtIndex(i, srcData[i]);
+        std::shared_ptr<GridProperty<double> > dstProp = directionProperty(faceDir);
+        dstProp->multiplyWith( *srcProp );
+        clearFaceMultipliers();
     }
 
 
@@ -117,11 +156,12 @@ namespace Opm {
         for (auto face_iter = fault->begin(); face_iter != fault->end(); ++face_iter) {
             std::shared_ptr<const FaultFace> face = *face_iter;
             FaceDir::DirEnum faceDir = face->getDir();
-            std::shared_ptr<GridProperty<double> > multProperty = getDirectionProperty(faceDir);
+            std::shared_ptr<GridProperty<double> > multProperty = directionProperty(faceDir);
 
             for (auto cell_iter = face->begin(); cell_iter != face->end(); ++cell_iter) {
                 size_t globalIndex = *cell_iter;
                 multProperty->multiplyValueAtIndex( globalIndex , transMult);
+                updateFaceMultiplier( globalIndex , faceDir , transMult );
             }
         }
     }
@@ -138,5 +178,121 @@ namespace Opm {
 
     void TransMult::setMultregtScanner( std::shared_ptr<const MULTREGTScanner> multregtScanner) {
         m_multregtScanner = multregtScanner;
+        clearFaceMultipliers();
+    }
+
+
+    std::shared_ptr<const std::vector<double> > TransMult::getFaceMultipliers(FaceDir::DirEnum faceDir) const {
+        if (faceDir != FaceDir::XPlus && faceDir != FaceDir::YPlus && faceDir != FaceDir::ZPlus)
+            throw std::invalid_argument("The face multipliers are only available for the XPlus, YPlus and ZPlus faces");
+
+        std::shared_ptr<std::vector<double> >& faceMultipliers = m_faceMultipliers[dimension( faceDir )];
+        std::shared_ptr<std::vector<double> > values = std::atomic_load( &faceMultipliers );
+        if (!values) {
+            std::shared_ptr<std::vector<double> > newValues = std::make_shared<std::vector<double> >();
+            std::vector<double>& multipliers = *newValues;
+            const size_t dims[3] = { m_nx , m_ny , m_nz };
+            const size_t strides[3] = { 1 , m_nx , m_nx * m_ny };
+            const size_t dim = dimension( faceDir );
+            const size_t stride = strides[dim];
+            const auto& plusProperty = m_trans[faceIndex( faceDir )];
+            const auto& minusProperty = m_trans[faceIndex( faceDir ) + 1];
+
+            // The boundary faces are 1.0 from the region multipliers.
+            getRegionMultipliers( faceDir , multipliers );
+            for (size_t g = 0; g < multipliers.size(); g++) {
+                if ((g / stride) % dims[dim] + 1 < dims[dim]) {
+                    if (plusProperty)
+                        multipliers[g] *= plusProperty->iget( g );
+                    if (minusProperty)
+                        multipliers[g] *= minusProperty->iget( g + stride );
+                }
+            }
+
+            std::shared_ptr<std::vector<double> > expected;
+            values = newValues;
+            if (!std::atomic_compare_exchange_strong( &faceMultipliers , &expected , values ))
+                values = expected;
+        }
+
+        return values;
+    }
+
+
+    /*
+      The XPlus face of cell g is the face between g and g + 1, while
+      the XMinus face is the face between g - 1 and g.
+    */
+    bool TransMult::getFacePosition(size_t globalIndex , FaceDir::DirEnum faceDir , FaceDir::DirEnum& plusDir , size_t& faceIndex) const {
+        if (globalIndex >= m_nx * m_ny * m_nz)
+            throw std::invalid_argument("Invalid global index");
+
+        const size_t dim = dimension( faceDir );
+        const size_t dims[3] = { m_nx , m_ny , m_nz };
+        const size_t strides[3] = { 1 , m_nx , m_nx * m_ny };
+        const size_t position = (globalIndex / strides[dim]) % dims[dim];
+        const bool plusFace = (TransMult::faceIndex( faceDir ) % 2) == 0;
+
+        plusDir = plusDirection( dim );
+        if (plusFace && position + 1 < dims[dim]) {
+            faceIndex = globalIndex;
+            return true;
+        } else if (!plusFace && position > 0) {
+            faceIndex = globalIndex - strides[dim];
+            return true;
+        } else
+            return false;
+    }
+
+
+    double TransMult::getFaceMultiplier(size_t faceIndex , FaceDir::DirEnum plusDir) const {
+        if (plusDir != FaceDir::XPlus && plusDir != FaceDir::YPlus && plusDir != FaceDir::ZPlus)
+            throw std::invalid_argument("The face multipliers are only available for the XPlus, YPlus and ZPlus faces");
+
+        std::shared_ptr<const std::vector<double> > multipliers = std::atomic_load( &m_faceMultipliers[dimension( plusDir )] );
+        if (multipliers)
+            return multipliers->at( faceIndex );
+
+        const size_t dim = dimension( plusDir );
+        const size_t dims[3] = { m_nx , m_ny , m_nz };
+        const size_t strides[3] = { 1 , m_nx , m_nx * m_ny };
+        if (faceIndex >= m_nx * m_ny * m_nz)
+            throw std::invalid_argument("Invalid face index");
+        if ((faceIndex / strides[dim]) % dims[dim] + 1 == dims[dim])
+            return 1.0;
+
+        const FaceDir::DirEnum minusDirs[3] = { FaceDir::XMinus , FaceDir::YMinus , FaceDir::ZMinus };
+        const size_t neighbourIndex = faceIndex + strides[dim];
+        double multiplier = getMultiplier__( faceIndex , plusDir ) * getMultiplier__( neighbourIndex , minusDirs[dim] );
+        if (m_multregtScanner)
+            multiplier *= m_multregtScanner->getRegionMultiplier( faceIndex , neighbourIndex , plusDir );
+
+        return multiplier;
+    }
+
+
+    /*
+      Writes into the array which getFaceMultipliers() has handed out;
+      see the comment in TransMult.hpp.
+    */
+    void TransMult::updateFaceMultiplier(size_t globalIndex , FaceDir::DirEnum faceDir , double factor) {
+        std::shared_ptr<std::vector<double> > multipliers = std::atomic_load( &m_faceMultipliers[dimension( faceDir )] );
+        if (!multipliers)
+            return;
+
+        FaceDir::DirEnum plusDir;
+        size_t faceIndex;
+        if (getFacePosition( globalIndex , faceDir , plusDir , faceIndex ))
+            (*multipliers)[faceIndex] *= factor;
+    }
+
+
+    /*
+      Only the cached pointers are reset; the arrays which have been
+      handed out are kept alive by the callers.
+    */
+    void TransMult::clearFaceMultipliers() {
+        for (auto& multipliers : m_faceMultipliers)
+            std::atomic_store( &multipliers , std::shared_ptr<std::vector<double> >() );
     }
 }
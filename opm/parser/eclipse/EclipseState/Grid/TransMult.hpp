@@ -25,14 +25,18 @@
 
       {MULTX , MULTX- , MULTY , MULTY- , MULTZ , MULTZ-, MULTFLT , MULTREGT}
 
+   For the transmissibility calculation all the multipliers of a face
+   are combined with getFaceMultipliers().
 */
 #ifndef TRANSMULT_HPP
 #define TRANSMULT_HPP
 
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
@@ -49,6 +53,34 @@ namespace Opm {
         double getMultiplier(size_t globalIndex, FaceDir::DirEnum faceDir) const;
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
+        // See MULTREGTScanner::getRegionMultipliers()
+        void getRegionMultipliers(FaceDir::DirEnum faceDir , std::vector<double>& multipliers) const;
+        /*
+          The combined multiplier of all faces in the direction XPlus,
+          YPlus or ZPlus: element g is the product of MULTX in cell g,
+          MULTX- in the neighbour g + 1, the MULTFLT of the faults
+          along the face and MULTREGT. The faces on the boundary are
+          1.0.
+
+          The array is computed on the first call and shared with the
+          later calls; concurrent first calls may both compute it, only
+          one is kept. getDirectionProperty(), applyMULT() and
+          setMultregtScanner() make the next call compute a new array,
+          while an array which has already been returned keeps the old
+          values. The MULTFLT updates from applyMULTFLT() are written
+          into the current array without synchronisation, so it must
+          not be read by other threads while applyMULTFLT() runs.
+        */
+        std::shared_ptr<const std::vector<double> > getFaceMultipliers(FaceDir::DirEnum faceDir) const;
+        /*
+          The position of the faceDir face of cell globalIndex in the
+          arrays from getFaceMultipliers(), e.g. the XMinus face of
+          cell g is element g - 1 of the XPlus array. Returns false
+          for the faces on the boundary.
+        */
+        bool getFacePosition(size_t globalIndex , FaceDir::DirEnum faceDir , FaceDir::DirEnum& plusDir , size_t& faceIndex) const;
+        // One element of getFaceMultipliers(plusDir), without building the array.
+        double getFaceMultiplier(size_t faceIndex , FaceDir::DirEnum plusDir) const;
         bool hasDirectionProperty(FaceDir::DirEnum faceDir) const;
         std::shared_ptr<GridProperty<double> > getDirectionProperty(FaceDir::DirEnum faceDir);
         void applyMULT(std::shared_ptr<const GridProperty<double> > srcMultProp, FaceDir::DirEnum faceDir);
@@ -61,9 +93,18 @@ namespace Opm {
         void assertIJK(size_t i , size_t j , size_t k) const;
         double getMultiplier__(size_t globalIndex , FaceDir::DirEnum faceDir) const;
         void insertNewProperty(FaceDir::DirEnum faceDir);
+        std::shared_ptr<GridProperty<double> > directionProperty(FaceDir::DirEnum faceDir);
+        void updateFaceMultiplier(size_t globalIndex , FaceDir::DirEnum faceDir , double factor);
+        void clearFaceMultipliers();
+        static size_t faceIndex(FaceDir::DirEnum faceDir);
+        static size_t dimension(FaceDir::DirEnum faceDir);
+        static FaceDir::DirEnum plusDirection(size_t dimension);
 
         size_t m_nx , m_ny , m_nz;
-        std::map<FaceDir::DirEnum , std::shared_ptr<GridProperty<double> > > m_trans;
+        // Indexed with faceIndex(); null for the directions without multipliers.
+        std::array<std::shared_ptr<GridProperty<double> > , 6> m_trans;
+        // Indexed with dimension(); null until computed, accessed with atomic_load().
+        mutable std::array<std::shared_ptr<std::vector<double> > , 3> m_faceMultipliers;
         std::map<FaceDir::DirEnum , std::string> m_names;
         std::shared_ptr<const MULTREGTScanner> m_multregtScanner;
     };
@@ -117,3 +117,36 @@ BOOST_AUTO_TEST_CASE(BoxEqual) {
 }
 
 
+
+
+BOOST_AUTO_TEST_CASE(IndexRuns) {
+    Opm::Box globalBox( 4 , 3 , 2 );
+    BOOST_CHECK_EQUAL( 1U , globalBox.getIndexRuns().size() );
+    BOOST_CHECK_EQUAL( 0U , globalBox.getIndexRuns()[0].start );
+    BOOST_CHECK_EQUAL( 24U , globalBox.getIndexRuns()[0].length );
+
+    // full I rows are merged within a layer
+    Opm::Box rowBox( globalBox , 0 , 3 , 1 , 2 , 0 , 1 );
+    BOOST_CHECK_EQUAL( 2U , rowBox.getIndexRuns().size() );
+    BOOST_CHECK_EQUAL( 4U , rowBox.getIndexRuns()[0].start );
+    BOOST_CHECK_EQUAL( 8U , rowBox.getIndexRuns()[0].length );
+    BOOST_CHECK_EQUAL( 16U , rowBox.getIndexRuns()[1].start );
+
+    // full layers are merged into one run
+    Opm::Box layerBox( globalBox , 0 , 3 , 0 , 2 , 1 , 1 );
+    BOOST_CHECK_EQUAL( 1U , layerBox.getIndexRuns().size() );
+    BOOST_CHECK_EQUAL( 12U , layerBox.getIndexRuns()[0].start );
+
+    Opm::Box subBox( globalBox , 1 , 2 , 0 , 1 , 0 , 1 );
+    BOOST_CHECK_EQUAL( 4U , subBox.getIndexRuns().size() );
+
+    for (const auto* box : { &globalBox , &rowBox , &layerBox , &subBox }) {
+        std::vector<size_t> indices;
+        for (const auto& run : box->getIndexRuns()) {
+            for (size_t index = run.start; index < run.start + run.length; index++)
+                indices.push_back( index );
+        }
+        BOOST_CHECK_EQUAL( box->size() , indices.size() );
+        BOOST_CHECK( indices == box->getIndexList() );
+    }
+}
@@ -0,0 +1,173 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <stdexcept>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#define BOOST_TEST_MODULE CornerPointGeometryTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/parser/eclipse/EclipseState/Grid/CornerPointGeometry.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+
+using namespace Opm;
+
+/*
+  Vertical pillars at x = i*dx, y = j*dy with the top of layer k at
+  depth k*dz.
+*/
+static std::shared_ptr<const std::vector<double> > createCOORD(size_t nx , size_t ny , double dx , double dy , double xShift = 0) {
+    std::shared_ptr<std::vector<double> > coord = std::make_shared<std::vector<double> >();
+    for (size_t j = 0; j <= ny; j++) {
+        for (size_t i = 0; i <= nx; i++) {
+            coord->push_back( i * dx );
+            coord->push_back( j * dy );
+            coord->push_back( 0 );
+            coord->push_back( i * dx + xShift );
+            coord->push_back( j * dy );
+            coord->push_back( 1 );
+        }
+    }
+    return coord;
+}
+
+
+static std::shared_ptr<const std::vector<double> > createZCORN(size_t nx , size_t ny , size_t nz , double dz) {
+    std::shared_ptr<std::vector<double> > zcorn = std::make_shared<std::vector<double> >();
+    for (size_t k = 0; k < nz; k++)
+        for (size_t dk = 0; dk < 2; dk++)
+            for (size_t n = 0; n < 4 * nx * ny; n++)
+                zcorn->push_back( (k + dk) * dz );
+    return zcorn;
+}
+
+
+BOOST_AUTO_TEST_CASE(InvalidSize) {
+    BOOST_CHECK_THROW( CornerPointGeometry( 2 , 2 , 1 , createCOORD( 2 , 1 , 1 , 1 ) , createZCORN( 2 , 2 , 1 , 1 )) , std::invalid_argument );
+    BOOST_CHECK_THROW( CornerPointGeometry( 2 , 2 , 1 , createCOORD( 2 , 2 , 1 , 1 ) , createZCORN( 2 , 2 , 2 , 1 )) , std::invalid_argument );
+    BOOST_CHECK_THROW( CornerPointGeometry( 2 , 2 , 1 , createCOORD( 2 , 2 , 1 , 1 ) , std::shared_ptr<const std::vector<double> >()) , std::invalid_argument );
+    BOOST_CHECK_NO_THROW( CornerPointGeometry( 2 , 2 , 1 , createCOORD( 2 , 2 , 1 , 1 ) , createZCORN( 2 , 2 , 1 , 1 )) );
+}
+
+
+BOOST_AUTO_TEST_CASE(RegularCells) {
+    CornerPointGeometry geometry( 3 , 2 , 2 , createCOORD( 3 , 2 , 10 , 20 ) , createZCORN( 3 , 2 , 2 , 2 ));
+    const size_t g = 1 + 1*3 + 1*6;
+
+    BOOST_CHECK_EQUAL( 12U , geometry.getCartesianSize() );
+    BOOST_CHECK_THROW( geometry.getCellVolume( 12 ) , std::invalid_argument );
+    BOOST_CHECK_CLOSE( 400.0 , geometry.getCellVolume( g ) , 1e-10 );
+    BOOST_CHECK_CLOSE( 2.0 , geometry.getCellThickness( g ) , 1e-10 );
+    BOOST_CHECK_CLOSE( 3.0 , geometry.getCellDepth( g ) , 1e-10 );
+
+    auto center = geometry.getCellCenter( g );
+    BOOST_CHECK_CLOSE( 15.0 , std::get<0>( center ) , 1e-10 );
+    BOOST_CHECK_CLOSE( 30.0 , std::get<1>( center ) , 1e-10 );
+    BOOST_CHECK_CLOSE( 3.0 , std::get<2>( center ) , 1e-10 );
+
+    CornerPointGeometry::FaceGeometry faces;
+    geometry.computeFaceGeometry( FaceDir::XPlus , faces );
+    BOOST_CHECK_CLOSE( 40.0 , faces.area[g] , 1e-10 );
+    BOOST_CHECK_CLOSE( 1.0 , faces.normalX[g] , 1e-10 );
+    BOOST_CHECK_SMALL( faces.normalY[g] , 1e-12 );
+
+    geometry.computeFaceGeometry( FaceDir::YPlus , faces );
+    BOOST_CHECK_CLOSE( 20.0 , faces.area[g] , 1e-10 );
+    BOOST_CHECK_CLOSE( 1.0 , faces.normalY[g] , 1e-10 );
+
+    geometry.computeFaceGeometry( FaceDir::ZPlus , faces );
+    BOOST_CHECK_CLOSE( 200.0 , faces.area[g] , 1e-10 );
+    BOOST_CHECK_CLOSE( 1.0 , faces.normalZ[g] , 1e-10 );
+
+    BOOST_CHECK_THROW( geometry.computeFaceGeometry( FaceDir::ZMinus , faces ) , std::invalid_argument );
+}
+
+
+BOOST_AUTO_TEST_CASE(DeformedCells) {
+    // Sheared pillars do not change the volume.
+    {
+        CornerPointGeometry geometry( 1 , 1 , 1 , createCOORD( 1 , 1 , 1 , 1 , 0.5 ) , createZCORN( 1 , 1 , 1 , 1 ));
+        BOOST_CHECK_CLOSE( 1.0 , geometry.getCellVolume( 0 ) , 1e-10 );
+        BOOST_CHECK_CLOSE( 0.75 , std::get<0>( geometry.getCellCenter( 0 )) , 1e-10 );
+
+        CornerPointGeometry::FaceGeometry faces;
+        geometry.computeFaceGeometry( FaceDir::XPlus , faces );
+        BOOST_CHECK_CLOSE( std::sqrt( 1.25 ) , faces.area[0] , 1e-10 );
+        BOOST_CHECK_CLOSE( 1.0 / std::sqrt( 1.25 ) , faces.normalX[0] , 1e-10 );
+        BOOST_CHECK_CLOSE( -0.5 / std::sqrt( 1.25 ) , faces.normalZ[0] , 1e-10 );
+    }
+
+    // One raised top corner gives a curved top face; the volume is 1 - 1/8.
+    {
+        std::shared_ptr<std::vector<double> > zcorn = std::make_shared<std::vector<double> >( *createZCORN( 1 , 1 , 1 , 1 ));
+        (*zcorn)[3] = 0.5;
+        CornerPointGeometry geometry( 1 , 1 , 1 , createCOORD( 1 , 1 , 1 , 1 ) , zcorn );
+        BOOST_CHECK_CLOSE( 0.875 , geometry.getCellVolume( 0 ) , 1e-10 );
+        BOOST_CHECK_CLOSE( 0.875 , geometry.getCellThickness( 0 ) , 1e-10 );
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(BulkGeometry) {
+    // Large enough to be computed in several threads.
+    const size_t nx = 100 , ny = 100 , nz = 25;
+    CornerPointGeometry geometry( nx , ny , nz , createCOORD( nx , ny , 10 , 20 , 3 ) , createZCORN( nx , ny , nz , 0.04 ));
+    std::vector<double> centerX , centerY , centerZ , depth , volume , thickness;
+    std::vector<double> singleDepth , singleVolume , singleThickness;
+    geometry.computeCellGeometry( centerX , centerY , centerZ , depth , volume , thickness );
+    geometry.computeCellDepths( singleDepth );
+    geometry.computeCellVolumes( singleVolume );
+    geometry.computeCellThicknesses( singleThickness );
+
+    BOOST_CHECK( depth == singleDepth );
+    BOOST_CHECK( volume == singleVolume );
+    BOOST_CHECK( thickness == singleThickness );
+
+    BOOST_CHECK_EQUAL( geometry.getCartesianSize() , volume.size() );
+    for (size_t g = 0; g < geometry.getCartesianSize(); g += 997) {
+        auto center = geometry.getCellCenter( g );
+        BOOST_CHECK_EQUAL( std::get<0>( center ) , centerX[g] );
+        BOOST_CHECK_EQUAL( std::get<1>( center ) , centerY[g] );
+        BOOST_CHECK_EQUAL( std::get<2>( center ) , centerZ[g] );
+        BOOST_CHECK_EQUAL( geometry.getCellDepth( g ) , depth[g] );
+        BOOST_CHECK_EQUAL( geometry.getCellVolume( g ) , volume[g] );
+        BOOST_CHECK_EQUAL( geometry.getCellThickness( g ) , thickness[g] );
+        BOOST_CHECK_CLOSE( 8.0 , volume[g] , 1e-8 );
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(EclipseGridGeometry) {
+    EclipseGrid grid( 4 , 3 , 2 , 10 , 20 , 2 );
+    const CornerPointGeometry& geometry = grid.getCornerPointGeometry();
+
+    BOOST_CHECK_EQUAL( &geometry , &grid.getCornerPointGeometry() );
+    BOOST_CHECK_EQUAL( 4U , geometry.getNX() );
+    for (size_t g = 0; g < grid.getCartesianSize(); g++) {
+        double x , y , z;
+        ecl_grid_get_xyz1( grid.c_ptr() , static_cast<int>(g) , &x , &y , &z );
+        BOOST_CHECK_CLOSE( x , std::get<0>( grid.getCellCenter( g )) , 1e-8 );
+        BOOST_CHECK_CLOSE( y , std::get<1>( grid.getCellCenter( g )) , 1e-8 );
+        BOOST_CHECK_CLOSE( z , std::get<2>( grid.getCellCenter( g )) , 1e-8 );
+        BOOST_CHECK_CLOSE( ecl_grid_get_cell_volume1( grid.c_ptr() , static_cast<int>(g) ) , grid.getCellVolume( g ) , 1e-8 );
+    }
+}
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <boost/filesystem.hpp>
@@ -639,12 +640,29 @@ BOOST_AUTO_TEST_CASE(ResetACTNUM) {
     Opm::EclipseGrid grid(deck);
     BOOST_CHECK_EQUAL( 1000U , grid.getNumActive());
     std::vector<int> actnum(1000);
+    BOOST_CHECK_EQUAL( 1000U , grid.getActiveToGlobal().size() );
+    BOOST_CHECK_EQUAL( 999 , grid.getGlobalToActive()[999] );
+    const std::vector<size_t>& activeToGlobal = grid.getActiveToGlobal();
+
     actnum[0] = 1;
     grid.resetACTNUM( actnum.data() );
     BOOST_CHECK_EQUAL( 1U , grid.getNumActive() );
+    BOOST_CHECK_EQUAL( 1U , grid.getActiveToGlobal().size() );
+    // The maps are updated in place.
+    BOOST_CHECK_EQUAL( &activeToGlobal , &grid.getActiveToGlobal() );
+    BOOST_CHECK_EQUAL( 1U , activeToGlobal.size() );
+
+    actnum[999] = 1;
+    grid.resetACTNUM( actnum.data() );
+    BOOST_CHECK_EQUAL( 2U , grid.getNumActive() );
+    BOOST_CHECK( grid.getActiveToGlobal() == std::vector<size_t>({ 0 , 999 }) );
+    BOOST_CHECK_EQUAL( 0 , grid.getGlobalToActive()[0] );
+    BOOST_CHECK_EQUAL( -1 , grid.getGlobalToActive()[1] );
+    BOOST_CHECK_EQUAL( 1 , grid.getGlobalToActive()[999] );
 
     grid.resetACTNUM( NULL );
     BOOST_CHECK_EQUAL( 1000U , grid.getNumActive() );
+    BOOST_CHECK_EQUAL( 1000U , grid.getActiveToGlobal().size() );
 }
 
 
@@ -768,3 +786,106 @@ BOOST_AUTO_TEST_CASE(ConstructorMINPV) {
     BOOST_CHECK_EQUAL(grid4.getMinpvMode(), Opm::MinpvMode::ModeEnum::OpmFIL);
     BOOST_CHECK_EQUAL(grid4.getMinpvValue(), 20.0);
 }
+
+
+BOOST_AUTO_TEST_CASE(CellGeometryArrays) {
+    // Large enough to be computed in several threads.
+    Opm::EclipseGrid grid( 80 , 60 , 50 , 10 , 20 , 2 );
+    const auto& volumes = grid.getCellVolumes();
+
+    BOOST_CHECK_EQUAL( grid.getCartesianSize() , volumes.size() );
+    BOOST_CHECK_EQUAL( &volumes , &grid.getCellVolumes() );
+
+    for (size_t g = 0; g < grid.getCartesianSize(); g += 997) {
+        BOOST_CHECK_EQUAL( std::get<2>( grid.getCellCenter( g )) , grid.getCellDepths()[g] );
+        BOOST_CHECK_EQUAL( grid.getCellDepth( g ) , grid.getCellDepths()[g] );
+        BOOST_CHECK_EQUAL( grid.getCellVolume( g ) , grid.getCellVolumes()[g] );
+        BOOST_CHECK_EQUAL( grid.getCellThicknes( g ) , grid.getCellThicknesses()[g] );
+    }
+    BOOST_CHECK_CLOSE( 400.0 , grid.getCellVolumes().back() , 1e-8 );
+}
+
+
+static Opm::DeckPtr createMinpvPinchDeck(size_t nx , size_t ny , size_t nz , const std::string& actnum , const std::string& threshold) {
+    const size_t numCells = nx * ny * nz;
+    const std::string deckData =
+        "RUNSPEC\n"
+        "\n"
+        "DIMENS\n"
+        " " + std::to_string( nx ) + " " + std::to_string( ny ) + " " + std::to_string( nz ) + " /\n"
+        "GRID\n"
+        "DX\n"
+        + std::to_string( numCells ) + "*1 /\n"
+        "DY\n"
+        + std::to_string( numCells ) + "*1 /\n"
+        "DZ\n"
+        + std::to_string( numCells ) + "*1 /\n"
+        "TOPS\n"
+        + std::to_string( nx * ny ) + "*0 /\n"
+        "ACTNUM\n"
+        + actnum + " /\n"
+        "MINPV\n"
+        "  0.5 /\n"
+        "PINCH\n"
+        "  " + threshold + " /\n"
+        "EDIT\n"
+        "\n";
+
+    Opm::ParserPtr parser(new Opm::Parser());
+    return parser->parseString(deckData, Opm::ParseMode()) ;
+}
+
+
+BOOST_AUTO_TEST_CASE(ProcessMINPVandPINCH) {
+    const std::vector<double> columnPorv = { 1 , 1 , 1 , 0.1 , 1 };
+    const std::vector<int> columnActnum = { 1 , 0 , 1 , 1 , 1 };
+    const std::vector<int> minpvActnum = { 1 , 0 , 1 , 0 , 1 };
+    {
+        Opm::EclipseGrid grid( createMinpvPinchDeck( 1 , 1 , 5 , "1 0 1 1 1" , "0.5" ));
+        std::vector<int> actnum;
+        grid.resetACTNUM( columnActnum.data() );
+
+        BOOST_CHECK_THROW( grid.processMINPVandPINCH( std::vector<double>( 4 , 1.0 ) , actnum ) , std::invalid_argument );
+
+        // The gaps of the inactive cell 1 and the MINPV cell 3 are thicker than the threshold.
+        auto connections = grid.processMINPVandPINCH( columnPorv , actnum );
+        BOOST_CHECK_EQUAL( 0U , connections.size() );
+        BOOST_CHECK_EQUAL_COLLECTIONS( minpvActnum.begin() , minpvActnum.end() , actnum.begin() , actnum.end() );
+        BOOST_CHECK_EQUAL( 4U , grid.getNumActive() );
+        BOOST_CHECK( grid.cellActive( 3 ));
+    }
+
+    {
+        Opm::EclipseGrid grid( createMinpvPinchDeck( 1 , 1 , 5 , "1 0 1 1 1" , "1.5" ));
+        std::vector<int> actnum;
+        grid.resetACTNUM( columnActnum.data() );
+
+        auto connections = grid.processMINPVandPINCH( columnPorv , actnum );
+        BOOST_CHECK_EQUAL( 2U , connections.size() );
+        BOOST_CHECK_EQUAL( 0U , connections[0].first );
+        BOOST_CHECK_EQUAL( 2U , connections[0].second );
+        BOOST_CHECK_EQUAL( 2U , connections[1].first );
+        BOOST_CHECK_EQUAL( 4U , connections[1].second );
+        BOOST_CHECK_EQUAL_COLLECTIONS( minpvActnum.begin() , minpvActnum.end() , actnum.begin() , actnum.end() );
+        BOOST_CHECK_EQUAL( 4U , grid.getNumActive() );
+    }
+
+    {
+        // Large enough to be processed in several threads.
+        const size_t nx = 100 , ny = 100 , nz = 20;
+        const Opm::EclipseGrid grid( createMinpvPinchDeck( nx , ny , nz , std::to_string( nx * ny * nz ) + "*1" , "1.5" ));
+        std::vector<double> porv( nx * ny * nz , 1.0 );
+        std::vector<int> actnum;
+        for (size_t column = 0; column < nx * ny; column++)
+            porv[column + 10 * nx * ny] = 0.1;
+
+        auto connections = grid.processMINPVandPINCH( porv , actnum );
+        BOOST_CHECK_EQUAL( nx * ny , connections.size() );
+        BOOST_CHECK_EQUAL( nx * ny * (nz - 1) , static_cast<size_t>( std::count( actnum.begin() , actnum.end() , 1 )));
+        BOOST_CHECK_EQUAL( nx * ny * nz , grid.getNumActive() );
+        for (size_t column = 0; column < connections.size(); column++) {
+            BOOST_CHECK_EQUAL( column + 9 * nx * ny , connections[column].first );
+            BOOST_CHECK_EQUAL( column + 11 * nx * ny , connections[column].second );
+        }
+    }
+}
@@ -96,3 +96,38 @@ BOOST_AUTO_TEST_CASE(getKeyword) {
 }
 
 
+
+
+BOOST_AUTO_TEST_CASE(RegionIndexCache) {
+    typedef Opm::GridProperties<int>::SupportedKeywordInfo SupportedKeywordInfo;
+    std::shared_ptr<std::vector<SupportedKeywordInfo> > supportedKeywords(new std::vector<SupportedKeywordInfo>{
+            SupportedKeywordInfo("MULTNUM" , 1, "1")
+        });
+
+    std::shared_ptr<const Opm::EclipseGrid> grid = std::make_shared<const Opm::EclipseGrid>(4,3,2);
+    Opm::GridProperties<int> gridProperties( grid , supportedKeywords);
+
+    BOOST_CHECK_THROW( gridProperties.getRegionIndex("MULTNUM") , std::invalid_argument);
+
+    auto multnum = gridProperties.getKeyword("MULTNUM");
+    auto index1 = gridProperties.getRegionIndex("MULTNUM");
+    BOOST_CHECK_EQUAL( 24U , index1->getCells(1).size() );
+    BOOST_CHECK_EQUAL( index1 , gridProperties.getRegionIndex("MULTNUM") );
+
+    multnum->iset( 5 , 2 );
+    auto index2 = gridProperties.getRegionIndex("MULTNUM");
+    BOOST_CHECK( index1 != index2 );
+    BOOST_CHECK_EQUAL( 23U , index2->getCells(1).size() );
+    BOOST_CHECK_EQUAL( 1U , index2->getCells(2).size() );
+    BOOST_CHECK_EQUAL( 5U , *index2->getCells(2).begin() );
+
+    multnum->regionSet( 3 , index2->getCells(1) );
+    auto index3 = gridProperties.getRegionIndex("MULTNUM");
+    BOOST_CHECK( !index3->hasRegion(1) );
+    BOOST_CHECK_EQUAL( 23U , index3->getCells(3).size() );
+
+    gridProperties.clearRegionIndices();
+    auto index4 = gridProperties.getRegionIndex("MULTNUM");
+    BOOST_CHECK( index3 != index4 );
+    BOOST_CHECK_EQUAL( 23U , index4->getCells(3).size() );
+}
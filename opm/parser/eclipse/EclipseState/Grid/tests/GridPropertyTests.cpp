@@ -541,6 +541,154 @@ BOOST_AUTO_TEST_CASE(kw_test) {
 }
 
 
+BOOST_AUTO_TEST_CASE(GatherScatterActive) {
+    typedef Opm::GridProperty<double>::SupportedKeywordInfo SupportedKeywordInfo;
+    SupportedKeywordInfo keywordInfo("P" , 0.0 , "1");
+    std::shared_ptr<Opm::EclipseGrid> grid = std::make_shared<Opm::EclipseGrid>( 4 , 3 , 2 );
+    Opm::GridProperty<double> p( 4 , 3 , 2 , keywordInfo);
+
+    for (size_t g = 0; g < p.getCartesianSize(); g++)
+        p.iset( g , g );
+
+    std::vector<int> actnum( 24 , 1 );
+    actnum[0] = 0;
+    actnum[5] = 0;
+    actnum[23] = 0;
+    grid->resetACTNUM( actnum.data() );
+
+    std::vector<double> activeValues = p.gatherActive( grid );
+    BOOST_CHECK_EQUAL( 21U , activeValues.size() );
+    BOOST_CHECK_EQUAL( 1 , activeValues[0] );
+    BOOST_CHECK_EQUAL( 6 , activeValues[4] );
+    BOOST_CHECK_EQUAL( 22 , activeValues[20] );
+
+    ERT::EclKW<double> kw = p.getEclKW( grid );
+    BOOST_CHECK_EQUAL( 21U , kw.size() );
+    BOOST_CHECK_EQUAL( 6 , kw[4] );
+
+    for (auto& value : activeValues)
+        value *= -1;
+    p.scatterActive( grid , activeValues );
+    BOOST_CHECK_EQUAL( 0 , p.iget(0) );
+    BOOST_CHECK_EQUAL( -1 , p.iget(1) );
+    BOOST_CHECK_EQUAL( 5 , p.iget(5) );
+    BOOST_CHECK_EQUAL( -22 , p.iget(22) );
+    BOOST_CHECK_EQUAL( 23 , p.iget(23) );
+
+    activeValues.pop_back();
+    BOOST_CHECK_THROW( p.scatterActive( grid , activeValues ) , std::invalid_argument );
+}
+
+
+BOOST_AUTO_TEST_CASE(ConstantStorage) {
+    typedef Opm::GridProperty<double>::SupportedKeywordInfo SupportedKeywordInfo;
+    SupportedKeywordInfo keywordInfo("MULTX" , 1.0 , "1");
+    Opm::GridProperty<double> p( 10 , 10 , 10 , keywordInfo);
+    std::shared_ptr<const Opm::Box> global = std::make_shared<const Opm::Box>( 10 , 10 , 10 );
+    std::shared_ptr<const Opm::Box> layer0 = std::make_shared<const Opm::Box>( *global , 0 , 9 , 0 , 9 , 0 , 0 );
+
+    BOOST_CHECK( p.isConstant() );
+    BOOST_CHECK_EQUAL( 0U , p.getMemoryUsage() );
+    BOOST_CHECK_EQUAL( 1000U , p.getCartesianSize() );
+    BOOST_CHECK_EQUAL( 1.0 , p.iget( 999 ) );
+    BOOST_CHECK( !p.containsNaN() );
+    p.checkLimits( 0 , 2 );
+
+    p.scale( 3 , global );
+    BOOST_CHECK( p.isConstant() );
+    BOOST_CHECK_EQUAL( 3.0 , p.iget( 5 , 5 , 5 ) );
+
+    p.scale( 2 , layer0 );
+    BOOST_CHECK( !p.isConstant() );
+    BOOST_CHECK_EQUAL( 1000U * sizeof(double) , p.getMemoryUsage() );
+    BOOST_CHECK_EQUAL( 6.0 , p.iget( 99 ) );
+    BOOST_CHECK_EQUAL( 3.0 , p.iget( 100 ) );
+
+    p.setScalar( 4 , global );
+    BOOST_CHECK( p.isConstant() );
+    BOOST_CHECK_EQUAL( 0U , p.getMemoryUsage() );
+
+    const std::vector<double>& data = p.getData();
+    BOOST_CHECK_EQUAL( 1000U , data.size() );
+    BOOST_CHECK_EQUAL( 4.0 , data[123] );
+    BOOST_CHECK( !p.isConstant() );
+}
+
+
+BOOST_AUTO_TEST_CASE(CompressIntProperty) {
+    typedef Opm::GridProperty<int>::SupportedKeywordInfo SupportedKeywordInfo;
+    SupportedKeywordInfo keywordInfo("FIPNUM" , 1 , "1");
+    Opm::GridProperty<int> p( 10 , 10 , 10 , keywordInfo);
+
+    for (size_t g = 0; g < p.getCartesianSize(); g++)
+        p.iset( g , g % 100 );
+    BOOST_CHECK( !p.isCompressed() );
+
+    p.compress();
+    BOOST_CHECK( p.isCompressed() );
+    BOOST_CHECK( !p.isConstant() );
+    BOOST_CHECK_EQUAL( 1000U , p.getMemoryUsage() );
+    BOOST_CHECK_EQUAL( 57 , p.iget( 457 ) );
+    BOOST_CHECK_THROW( p.checkLimits( 1 , 99 ) , std::invalid_argument );
+
+    p.iset( 0 , 1000 );
+    BOOST_CHECK( !p.isCompressed() );
+    BOOST_CHECK_EQUAL( 1000 , p.iget( 0 ) );
+    BOOST_CHECK_EQUAL( 57 , p.iget( 457 ) );
+
+    p.compress();
+    BOOST_CHECK( p.isCompressed() );
+    BOOST_CHECK_EQUAL( 2000U , p.getMemoryUsage() );
+    BOOST_CHECK_EQUAL( 1000 , p.iget( 0 ) );
+
+    p.iset( 0 , 100000 );
+    p.compress();
+    BOOST_CHECK( !p.isCompressed() );
+
+    SupportedKeywordInfo satnumInfo("SATNUM" , 1 , "1");
+    Opm::GridProperty<int> satnum( 10 , 10 , 10 , satnumInfo);
+    satnum.iset( 0 , 1 );
+    satnum.compress();
+    BOOST_CHECK( satnum.isConstant() );
+    BOOST_CHECK_EQUAL( 0U , satnum.getMemoryUsage() );
+}
+
+
+BOOST_AUTO_TEST_CASE(CompressedReadsAndDataReference) {
+    typedef Opm::GridProperty<int>::SupportedKeywordInfo SupportedKeywordInfo;
+    SupportedKeywordInfo keywordInfo("SATNUM" , 1 , "1");
+    Opm::GridProperty<int> p( 10 , 10 , 10 , keywordInfo);
+    Opm::GridProperty<int> q( 10 , 10 , 10 , keywordInfo);
+    std::shared_ptr<const Opm::Box> global = std::make_shared<const Opm::Box>( 10 , 10 , 10 );
+
+    for (size_t g = 0; g < q.getCartesianSize(); g++)
+        q.iset( g , 1 + g % 3 );
+    q.compress();
+
+    // Reading a compressed property does not expand it.
+    p.multiplyWith( q );
+    p.copyFrom( q , global );
+    BOOST_CHECK( q.isCompressed() );
+    BOOST_CHECK_EQUAL( 3 , p.iget( 2 ) );
+    BOOST_CHECK_EQUAL( 1000U , q.getEclKW().size() );
+    std::vector<int> values( 10 );
+    q.copyValues( 990 , 1000 , values.data() );
+    BOOST_CHECK_EQUAL( 1 + 999 % 3 , values[9] );
+    BOOST_CHECK( q.isCompressed() );
+
+    // The vector returned by getData() is kept; also through a const reference.
+    const Opm::GridProperty<int>& constQ = q;
+    const std::vector<int>& data = constQ.getData();
+    BOOST_CHECK( !q.isCompressed() );
+    q.compress();
+    BOOST_CHECK( !q.isCompressed() );
+    q.setScalar( 7 , global );
+    BOOST_CHECK( !q.isConstant() );
+    BOOST_CHECK_EQUAL( &data , &q.getData() );
+    BOOST_CHECK_EQUAL( 7 , data[999] );
+}
+
+
 BOOST_AUTO_TEST_CASE(CheckLimits) {
     typedef Opm::GridProperty<int>::SupportedKeywordInfo SupportedKeywordInfo;
     SupportedKeywordInfo keywordInfo1("P" , 1 , "1");
@@ -115,19 +115,19 @@ BOOST_AUTO_TEST_CASE(InvalidInput) {
     std::vector<Opm::DeckKeywordConstPtr> keywords0;
     Opm::DeckKeywordConstPtr multregtKeyword0 = deck->getKeyword("MULTREGT",0);
     keywords0.push_back( multregtKeyword0 );
-    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(gridProperties,keywords0,"MULTNUM"); , std::invalid_argument);
+    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(grid,gridProperties,keywords0,"MULTNUM"); , std::invalid_argument);
 
     // Not supported region
     std::vector<Opm::DeckKeywordConstPtr> keywords1;
     Opm::DeckKeywordConstPtr multregtKeyword1 = deck->getKeyword("MULTREGT",1);
     keywords1.push_back( multregtKeyword1 );
-    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(gridProperties,keywords1,"MULTNUM"); , std::invalid_argument);
+    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(grid,gridProperties,keywords1,"MULTNUM"); , std::invalid_argument);
 
     // The keyword is ok; but it refers to a region which is not in the deck.
     std::vector<Opm::DeckKeywordConstPtr> keywords2;
     Opm::DeckKeywordConstPtr multregtKeyword2 = deck->getKeyword("MULTREGT",2);
     keywords2.push_back( multregtKeyword2 );
-    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(gridProperties,keywords2,"MULTNUM"); , std::logic_error);
+    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(grid,gridProperties,keywords2,"MULTNUM"); , std::logic_error);
 }
 
 
@@ -181,29 +181,46 @@ BOOST_AUTO_TEST_CASE(NotSupported) {
     std::vector<Opm::DeckKeywordConstPtr> keywords0;
     Opm::DeckKeywordConstPtr multregtKeyword0 = deck->getKeyword("MULTREGT",0);
     keywords0.push_back( multregtKeyword0 );
-    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(gridProperties,keywords0,"MULTNUM"); , std::invalid_argument);
+    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(grid,gridProperties,keywords0,"MULTNUM"); , std::invalid_argument);
 
     // Defaulted from value - not supported
     std::vector<Opm::DeckKeywordConstPtr> keywords1;
     Opm::DeckKeywordConstPtr multregtKeyword1 = deck->getKeyword("MULTREGT",1);
     keywords1.push_back( multregtKeyword1 );
-    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(gridProperties,keywords1,"MULTNUM"); , std::invalid_argument);
+    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(grid,gridProperties,keywords1,"MULTNUM"); , std::invalid_argument);
 
     // Defaulted to value - not supported
     std::vector<Opm::DeckKeywordConstPtr> keywords2;
     Opm::DeckKeywordConstPtr multregtKeyword2 = deck->getKeyword("MULTREGT",2);
     keywords2.push_back( multregtKeyword2 );
-    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(gridProperties,keywords2,"MULTNUM"); , std::invalid_argument);
+    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(grid,gridProperties,keywords2,"MULTNUM"); , std::invalid_argument);
 
 
     // srcValue == targetValue - not supported
     std::vector<Opm::DeckKeywordConstPtr> keywords3;
     Opm::DeckKeywordConstPtr multregtKeyword3 = deck->getKeyword("MULTREGT",3);
     keywords3.push_back( multregtKeyword3 );
-    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(gridProperties,keywords3 , "MULTNUM"); , std::invalid_argument);
+    BOOST_CHECK_THROW( Opm::MULTREGTScanner scanner(grid,gridProperties,keywords3 , "MULTNUM"); , std::invalid_argument);
 
 }
 
+BOOST_AUTO_TEST_CASE(NoRegionProperties) {
+    typedef Opm::GridProperties<int>::SupportedKeywordInfo SupportedKeywordInfo;
+    std::shared_ptr<std::vector<SupportedKeywordInfo> > supportedKeywords(new std::vector<SupportedKeywordInfo>{
+            SupportedKeywordInfo("MULTNUM" , 1 , "1") });
+    std::shared_ptr<const Opm::EclipseGrid> grid = std::make_shared<const Opm::EclipseGrid>(4,3,2);
+    std::shared_ptr<Opm::GridProperties<int> > gridProperties = std::make_shared<Opm::GridProperties<int> >(grid, supportedKeywords);
+
+    // The size of the grid comes from the grid, not from a region property.
+    Opm::MULTREGTScanner scanner(grid, gridProperties, std::vector<Opm::DeckKeywordConstPtr>(), "MULTNUM");
+    std::vector<double> multipliers;
+    scanner.getRegionMultipliers( Opm::FaceDir::XPlus , multipliers );
+    BOOST_CHECK_EQUAL( 24U , multipliers.size() );
+    for (double multiplier : multipliers)
+        BOOST_CHECK_EQUAL( 1.0 , multiplier );
+}
+
+
 static Opm::DeckPtr createCopyMULTNUMDeck() {
     const char *deckData =
         "RUNSPEC\n"
@@ -236,3 +253,45 @@ BOOST_AUTO_TEST_CASE(MULTREGT_COPY_MULTNUM) {
     Opm::DeckPtr deck = createCopyMULTNUMDeck();
     Opm::EclipseState state(deck , Opm::ParseMode());
 }
+
+
+static Opm::DeckPtr createLargeRegionMULTREGTDeck(const std::string& multnum) {
+    const std::string deckData =
+        "RUNSPEC\n"
+        "\n"
+        "DIMENS\n"
+        "3 1 1 /\n"
+        "GRID\n"
+        "MULTNUM\n"
+        + multnum + " /\n"
+        "MULTREGT\n"
+        "1  4000      0.50   X   ALL    M / \n"
+        "4000  3000000   0.25   X   ALL    M / \n"
+        "/\n"
+        "EDIT\n"
+        "\n";
+
+    Opm::ParserPtr parser(new Opm::Parser());
+    return parser->parseString(deckData, Opm::ParseMode()) ;
+}
+
+
+BOOST_AUTO_TEST_CASE(MULTREGT_LARGE_REGION_VALUES) {
+    // The region values used in the records are numbered consecutively in the table.
+    {
+        Opm::EclipseState state(createLargeRegionMULTREGTDeck( "1 4000 1" ) , Opm::ParseMode());
+        auto transMult = state.getTransMult();
+        BOOST_CHECK_EQUAL( 0.50 , transMult->getRegionMultiplier( 0 , 1 , Opm::FaceDir::XPlus ));
+        BOOST_CHECK_EQUAL( 0.50 , transMult->getRegionMultiplier( 1 , 2 , Opm::FaceDir::XPlus ));
+        BOOST_CHECK_EQUAL( 1.00 , transMult->getRegionMultiplier( 0 , 2 , Opm::FaceDir::XPlus ));
+    }
+
+    // The range of the region values is too large for a table.
+    {
+        Opm::EclipseState state(createLargeRegionMULTREGTDeck( "1 4000 3000000" ) , Opm::ParseMode());
+        auto transMult = state.getTransMult();
+        BOOST_CHECK_EQUAL( 0.50 , transMult->getRegionMultiplier( 0 , 1 , Opm::FaceDir::XPlus ));
+        BOOST_CHECK_EQUAL( 0.25 , transMult->getRegionMultiplier( 1 , 2 , Opm::FaceDir::XPlus ));
+        BOOST_CHECK_EQUAL( 1.00 , transMult->getRegionMultiplier( 0 , 2 , Opm::FaceDir::XPlus ));
+    }
+}
@@ -0,0 +1,91 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_MODULE RegionIndexTests
+
+#include <opm/common/utility/platform_dependent/disable_warnings.h>
+#include <boost/test/unit_test.hpp>
+#include <opm/common/utility/platform_dependent/reenable_warnings.h>
+
+#include <opm/parser/eclipse/EclipseState/Grid/RegionIndex.hpp>
+
+
+static std::vector<size_t> cellList(const Opm::RegionIndex::Cells& cells) {
+    return std::vector<size_t>( cells.begin() , cells.end() );
+}
+
+
+BOOST_AUTO_TEST_CASE(EmptyIndex) {
+    Opm::RegionIndex index( std::vector<int>{} );
+    BOOST_CHECK( !index.hasRegion(1) );
+    BOOST_CHECK_EQUAL( 0U , index.getCells(1).size() );
+    BOOST_CHECK( index.getRegions().empty() );
+}
+
+
+BOOST_AUTO_TEST_CASE(DenseRegions) {
+    Opm::RegionIndex index( { 2 , 1 , 2 , 4 , 1 , 2 } );
+
+    BOOST_CHECK( index.hasRegion(1) );
+    BOOST_CHECK( !index.hasRegion(3) );
+    BOOST_CHECK( !index.hasRegion(0) );
+    BOOST_CHECK( !index.hasRegion(5) );
+    BOOST_CHECK( index.getRegions() == std::vector<int>({ 1 , 2 , 4 }) );
+
+    BOOST_CHECK( cellList( index.getCells(1) ) == std::vector<size_t>({ 1 , 4 }) );
+    BOOST_CHECK( cellList( index.getCells(2) ) == std::vector<size_t>({ 0 , 2 , 5 }) );
+    BOOST_CHECK( cellList( index.getCells(4) ) == std::vector<size_t>({ 3 }) );
+    BOOST_CHECK_EQUAL( 0U , index.getCells(3).size() );
+}
+
+
+BOOST_AUTO_TEST_CASE(SparseRegions) {
+    // The spread of the values is too large for a dense offset table.
+    Opm::RegionIndex index( { 1000000000 , -7 , 1000000000 , 0 } );
+
+    BOOST_CHECK( index.getRegions() == std::vector<int>({ -7 , 0 , 1000000000 }) );
+    BOOST_CHECK( cellList( index.getCells(1000000000) ) == std::vector<size_t>({ 0 , 2 }) );
+    BOOST_CHECK( cellList( index.getCells(-7) ) == std::vector<size_t>({ 1 }) );
+    BOOST_CHECK( !index.hasRegion(1) );
+    BOOST_CHECK( !index.hasRegion(999999999) );
+}
+
+
+BOOST_AUTO_TEST_CASE(ReadInChunks) {
+    // More cells than one chunk, with sparse values spread over the chunks.
+    const size_t numCells = 200000;
+    size_t reads = 0;
+    Opm::RegionIndex index( numCells , [&reads](size_t begin , size_t end , int* target) {
+            reads++;
+            for (size_t g = begin; g < end; g++)
+                target[g - begin] = (g % 3 == 0) ? 1000000000 : static_cast<int>( g / 100000 );
+        });
+
+    BOOST_CHECK( reads > 1 );
+    BOOST_CHECK( index.getRegions() == std::vector<int>({ 0 , 1 , 1000000000 }) );
+    BOOST_CHECK_EQUAL( (numCells + 2) / 3 , index.getCells(1000000000).size() );
+    BOOST_CHECK_EQUAL( numCells , index.getCells(0).size() + index.getCells(1).size() + index.getCells(1000000000).size() );
+
+    const auto cells = cellList( index.getCells(1) );
+    BOOST_CHECK_EQUAL( 100000U , cells.front() );
+    BOOST_CHECK( std::is_sorted( cells.begin() , cells.end() ) );
+}
@@ -19,6 +19,8 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <thread>
+#include <vector>
 #include <boost/filesystem.hpp>
 
 #define BOOST_TEST_MODULE EclipseGridTests
@@ -48,3 +50,95 @@ BOOST_AUTO_TEST_CASE(Empty) {
     BOOST_CHECK_EQUAL( mult->getKeywordName() , "MULTZ");
     BOOST_CHECK( transMult.hasDirectionProperty( Opm::FaceDir::ZPlus ));
 }
+
+
+BOOST_AUTO_TEST_CASE(FaceMultipliers) {
+    Opm::TransMult transMult(3,2,1);
+    Opm::GridPropertySupportedKeywordInfo<double> multxInfo("MULTX" , 1.0 , "1");
+    Opm::GridPropertySupportedKeywordInfo<double> multxMinusInfo("MULTX-" , 1.0 , "1");
+    std::shared_ptr<Opm::GridProperty<double> > multx = std::make_shared<Opm::GridProperty<double> >(3,2,1,multxInfo);
+    std::shared_ptr<Opm::GridProperty<double> > multxMinus = std::make_shared<Opm::GridProperty<double> >(3,2,1,multxMinusInfo);
+
+    multx->iset(0 , 2.0);
+    multxMinus->iset(1 , 3.0);
+    multxMinus->iset(3 , 5.0);
+    transMult.applyMULT( multx , Opm::FaceDir::XPlus );
+    transMult.applyMULT( multxMinus , Opm::FaceDir::XMinus );
+
+    BOOST_CHECK_THROW( transMult.getFaceMultipliers( Opm::FaceDir::XMinus ) , std::invalid_argument );
+    {
+        std::shared_ptr<const std::vector<double> > faceMultPtr = transMult.getFaceMultipliers( Opm::FaceDir::XPlus );
+        const std::vector<double>& faceMult = *faceMultPtr;
+        BOOST_CHECK_EQUAL( faceMult.size() , 6U );
+        BOOST_CHECK_EQUAL( faceMult[0] , 6.0 );
+        BOOST_CHECK_EQUAL( faceMult[1] , 1.0 );
+        // The boundary face of cell 2 is 1.0; cell 3 is in the next row.
+        BOOST_CHECK_EQUAL( faceMult[2] , 1.0 );
+        BOOST_CHECK_EQUAL( faceMult[3] , 1.0 );
+
+        std::shared_ptr<const std::vector<double> > faceMultYPtr = transMult.getFaceMultipliers( Opm::FaceDir::YPlus );
+        const std::vector<double>& faceMultY = *faceMultYPtr;
+        for (size_t g = 0; g < faceMultY.size(); g++)
+            BOOST_CHECK_EQUAL( faceMultY[g] , 1.0 );
+    }
+
+    {
+        std::shared_ptr<Opm::Fault> fault = std::make_shared<Opm::Fault>("FAULT");
+        fault->addFace( std::make_shared<Opm::FaultFace>(3,2,1 , 1,1 , 0,1 , 0,0 , Opm::FaceDir::XPlus) );
+        fault->addFace( std::make_shared<Opm::FaultFace>(3,2,1 , 1,1 , 0,1 , 0,0 , Opm::FaceDir::XMinus) );
+        fault->setTransMult( 0.5 );
+        transMult.applyMULTFLT( fault );
+
+        std::shared_ptr<const std::vector<double> > faceMultPtr = transMult.getFaceMultipliers( Opm::FaceDir::XPlus );
+        const std::vector<double>& faceMult = *faceMultPtr;
+        BOOST_CHECK_EQUAL( faceMult[0] , 3.0 );
+        BOOST_CHECK_EQUAL( faceMult[1] , 0.5 );
+        BOOST_CHECK_EQUAL( faceMult[3] , 0.5 );
+        BOOST_CHECK_EQUAL( faceMult[4] , 0.5 );
+        BOOST_CHECK_EQUAL( faceMult[5] , 1.0 );
+        for (size_t g = 0; g < faceMult.size(); g++)
+            BOOST_CHECK_EQUAL( faceMult[g] , transMult.getMultiplier(g , Opm::FaceDir::XPlus) * (g % 3 < 2 ? transMult.getMultiplier(g + 1 , Opm::FaceDir::XMinus) : 1.0) );
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(ConcurrentFaceMultipliers) {
+    Opm::TransMult transMult(10,10,10);
+    Opm::GridPropertySupportedKeywordInfo<double> multzInfo("MULTZ" , 1.0 , "1");
+    std::shared_ptr<Opm::GridProperty<double> > multz = std::make_shared<Opm::GridProperty<double> >(10,10,10,multzInfo);
+    multz->iset(0 , 2.0);
+    transMult.applyMULT( multz , Opm::FaceDir::ZPlus );
+
+    // Concurrent first calls all see the same array.
+    const Opm::TransMult& constTransMult = transMult;
+    std::vector<std::shared_ptr<const std::vector<double> > > faceMults( 4 );
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < faceMults.size(); index++)
+        threads.emplace_back( [&faceMults , &constTransMult , index]() { faceMults[index] = constTransMult.getFaceMultipliers( Opm::FaceDir::ZPlus ); } );
+    for (auto& thread : threads)
+        thread.join();
+    for (const auto& faceMult : faceMults)
+        BOOST_CHECK_EQUAL( faceMult , faceMults[0] );
+    BOOST_CHECK_EQUAL( 2.0 , (*faceMults[0])[0] );
+}
+
+
+BOOST_AUTO_TEST_CASE(FaceMultipliersOutliveModifications) {
+    Opm::TransMult transMult(3,1,1);
+    Opm::GridPropertySupportedKeywordInfo<double> multxInfo("MULTX" , 1.0 , "1");
+    std::shared_ptr<Opm::GridProperty<double> > multx = std::make_shared<Opm::GridProperty<double> >(3,1,1,multxInfo);
+    multx->iset(0 , 2.0);
+
+    std::shared_ptr<const std::vector<double> > faceMult = transMult.getFaceMultipliers( Opm::FaceDir::XPlus );
+    BOOST_CHECK_EQUAL( (*faceMult)[0] , 1.0 );
+
+    // The array which has been handed out is still valid and keeps its values.
+    transMult.getDirectionProperty( Opm::FaceDir::XPlus );
+    transMult.applyMULT( multx , Opm::FaceDir::XPlus );
+    BOOST_CHECK_EQUAL( faceMult->size() , 3U );
+    BOOST_CHECK_EQUAL( (*faceMult)[0] , 1.0 );
+
+    std::shared_ptr<const std::vector<double> > newFaceMult = transMult.getFaceMultipliers( Opm::FaceDir::XPlus );
+    BOOST_CHECK( newFaceMult != faceMult );
+    BOOST_CHECK_EQUAL( (*newFaceMult)[0] , 2.0 );
+}
@@ -0,0 +1,162 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/FaultMultiplierHistory.hpp>
+
+namespace Opm {
+
+    FaultMultiplierHistory::FaultMultiplierHistory(const ParseMode& parseMode ,
+                                                   std::shared_ptr<const FaultCollection> faults ,
+                                                   std::shared_ptr<const TransMult> transMult ,
+                                                   std::shared_ptr<const Schedule> schedule) :
+        m_numTimeSteps( schedule->getTimeMap()->size() )
+    {
+        for (const auto& faultName : schedule->getFaultMultiplierNames()) {
+            if (faults->hasFault( faultName ))
+                m_faultNames.push_back( faultName );
+            else
+                parseMode.handleError( ParseMode::SCHEDULE_MULTFLT_UNKNOWN_FAULT , "MULTFLT in the SCHEDULE section for the unknown fault: " + faultName );
+        }
+
+        /*
+          (faceDir , faceIndex , faultIndex) for every face of the
+          faults; a face listed twice is kept twice.
+        */
+        std::vector<std::tuple<FaceDir::DirEnum , size_t , size_t> > faultFaces;
+        for (size_t faultIndex = 0; faultIndex < m_faultNames.size(); faultIndex++) {
+            const std::string& faultName = m_faultNames[faultIndex];
+            std::vector<double> multipliers( m_numTimeSteps );
+            for (size_t timeStep = 0; timeStep < m_numTimeSteps; timeStep++)
+                multipliers[timeStep] = schedule->getFaultMultiplier( faultName , timeStep );
+            m_faultMultipliers.push_back( multipliers );
+
+            auto fault = faults->getFault( faultName );
+            for (auto face_iter = fault->begin(); face_iter != fault->end(); ++face_iter) {
+                auto face = *face_iter;
+                for (auto cell_iter = face->begin(); cell_iter != face->end(); ++cell_iter) {
+                    FaceDir::DirEnum plusDir;
+                    size_t faceIndex;
+                    if (transMult->getFacePosition( *cell_iter , face->getDir() , plusDir , faceIndex ))
+                        faultFaces.push_back( std::make_tuple( plusDir , faceIndex , faultIndex ));
+                }
+            }
+        }
+
+        std::sort( faultFaces.begin() , faultFaces.end() );
+
+        m_faultFaces.resize( m_faultNames.size() );
+        for (size_t index = 0; index < faultFaces.size(); index++) {
+            const FaceDir::DirEnum faceDir = std::get<0>( faultFaces[index] );
+            const size_t globalIndex = std::get<1>( faultFaces[index] );
+            const size_t faultIndex = std::get<2>( faultFaces[index] );
+
+            if (m_faces.empty() || m_faces.back().faceDir != faceDir || m_faces.back().globalIndex != globalIndex) {
+                Face newFace;
+                newFace.faceDir = faceDir;
+                newFace.globalIndex = globalIndex;
+                newFace.baseMultiplier = transMult->getFaceMultiplier( globalIndex , faceDir );
+                newFace.faultBegin = m_faceFaults.size();
+                newFace.faultEnd = m_faceFaults.size();
+                m_faces.push_back( newFace );
+            }
+
+            m_faceFaults.push_back( faultIndex );
+            m_faces.back().faultEnd++;
+            if (m_faultFaces[faultIndex].empty() || m_faultFaces[faultIndex].back() != m_faces.size() - 1)
+                m_faultFaces[faultIndex].push_back( m_faces.size() - 1 );
+        }
+    }
+
+
+    size_t FaultMultiplierHistory::numTimeSteps() const {
+        return m_numTimeSteps;
+    }
+
+
+    size_t FaultMultiplierHistory::numFaults() const {
+        return m_faultNames.size();
+    }
+
+
+    const std::string& FaultMultiplierHistory::getFaultName(size_t faultIndex) const {
+        return m_faultNames.at( faultIndex );
+    }
+
+
+    double FaultMultiplierHistory::getFaultMultiplier(size_t faultIndex , size_t timeStep) const {
+        assertTimeStep( timeStep );
+        return m_faultMultipliers.at( faultIndex )[timeStep];
+    }
+
+
+    size_t FaultMultiplierHistory::numFaces() const {
+        return m_faces.size();
+    }
+
+
+    void FaultMultiplierHistory::assertTimeStep(size_t timeStep) const {
+        if (timeStep >= m_numTimeSteps)
+            throw std::invalid_argument("Invalid report step: " + std::to_string( timeStep ));
+    }
+
+
+    double FaultMultiplierHistory::getFaceMultiplier(const Face& face , size_t timeStep) const {
+        double multiplier = face.baseMultiplier;
+        for (size_t index = face.faultBegin; index < face.faultEnd; index++)
+            multiplier *= m_faultMultipliers[m_faceFaults[index]][timeStep];
+        return multiplier;
+    }
+
+
+    /*
+      Only the faces of the faults with a different multiplier in the
+      two steps are considered; a face can still be unchanged when
+      several faults along it change with factors which cancel.
+    */
+    std::vector<FaultMultiplierHistory::FaceChange> FaultMultiplierHistory::getChanges(size_t fromStep , size_t toStep) const {
+        assertTimeStep( fromStep );
+        assertTimeStep( toStep );
+
+        std::vector<size_t> faceIndices;
+        for (size_t faultIndex = 0; faultIndex < m_faultNames.size(); faultIndex++) {
+            const std::vector<double>& multipliers = m_faultMultipliers[faultIndex];
+            if (multipliers[fromStep] != multipliers[toStep])
+                faceIndices.insert( faceIndices.end() , m_faultFaces[faultIndex].begin() , m_faultFaces[faultIndex].end() );
+        }
+        std::sort( faceIndices.begin() , faceIndices.end() );
+        faceIndices.erase( std::unique( faceIndices.begin() , faceIndices.end() ) , faceIndices.end() );
+
+        std::vector<FaceChange> changes;
+        for (size_t faceIndex : faceIndices) {
+            const Face& face = m_faces[faceIndex];
+            const double multiplier = getFaceMultiplier( face , toStep );
+            if (multiplier != getFaceMultiplier( face , fromStep )) {
+                FaceChange change;
+                change.faceDir = face.faceDir;
+                change.globalIndex = face.globalIndex;
+                change.multiplier = multiplier;
+                changes.push_back( change );
+            }
+        }
+        return changes;
+    }
+}
@@ -0,0 +1,101 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef FAULT_MULTIPLIER_HISTORY_HPP
+#define FAULT_MULTIPLIER_HISTORY_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/FaultCollection.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/TransMult.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+
+namespace Opm {
+
+    /*
+      The face multipliers of the faults with MULTFLT in the SCHEDULE
+      section, resolved for every report step.
+
+      The multipliers are the elements of
+      TransMult::getFaceMultipliers() as they are at the end of the
+      GRID and EDIT sections, multiplied with the SCHEDULE factors of
+      all the faults along the face. getChanges() returns the faces
+      which differ between two report steps, so the transmissibilities
+      can be updated incrementally instead of applying the modifier
+      deck of every step.
+
+      A face which a fault lists more than once, e.g. from both sides,
+      gets the factor of the fault once per entry, as when the
+      modifier deck is applied to the TransMult object.
+    */
+    class FaultMultiplierHistory {
+    public:
+        struct FaceChange {
+            // One of XPlus, YPlus and ZPlus; see TransMult::getFacePosition().
+            FaceDir::DirEnum faceDir;
+            size_t globalIndex;
+            double multiplier;
+        };
+
+        FaultMultiplierHistory(const ParseMode& parseMode ,
+                               std::shared_ptr<const FaultCollection> faults ,
+                               std::shared_ptr<const TransMult> transMult ,
+                               std::shared_ptr<const Schedule> schedule);
+
+        size_t numTimeSteps() const;
+        size_t numFaults() const;
+        const std::string& getFaultName(size_t faultIndex) const;
+        double getFaultMultiplier(size_t faultIndex , size_t timeStep) const;
+        size_t numFaces() const;
+
+        // The faces which differ between the two steps, sorted on face direction and index.
+        std::vector<FaceChange> getChanges(size_t fromStep , size_t toStep) const;
+
+    private:
+        struct Face {
+            FaceDir::DirEnum faceDir;
+            size_t globalIndex;
+            double baseMultiplier;
+            // Range in m_faceFaults.
+            size_t faultBegin;
+            size_t faultEnd;
+        };
+
+        double getFaceMultiplier(const Face& face , size_t timeStep) const;
+        void assertTimeStep(size_t timeStep) const;
+
+        size_t m_numTimeSteps;
+        std::vector<std::string> m_faultNames;
+        // m_faultMultipliers[faultIndex][timeStep]
+        std::vector<std::vector<double> > m_faultMultipliers;
+        std::vector<Face> m_faces;
+        std::vector<size_t> m_faceFaults;
+        // The indices in m_faces of the faces of every fault.
+        std::vector<std::vector<size_t> > m_faultFaces;
+    };
+
+    typedef std::shared_ptr<FaultMultiplierHistory> FaultMultiplierHistoryPtr;
+    typedef std::shared_ptr<const FaultMultiplierHistory> FaultMultiplierHistoryConstPtr;
+}
+
+#endif
@@ -120,98 +120,126 @@ namespace Opm {
         for (size_t keywordIdx = 0; keywordIdx < section->size(); ++keywordIdx) {
             DeckKeywordConstPtr keyword = section->getKeyword(keywordIdx);
 
-            if (keyword->name() == "DATES") {
+            switch (ParserKeywords::getKeywordId( *keyword )) {
+            case ParserKeywords::DATES::keywordId:
                 handleDATES(keyword);
                 currentStep += keyword->size();
-            }
+                break;
 
-            if (keyword->name() == "TSTEP") {
+            case ParserKeywords::TSTEP::keywordId:
                 handleTSTEP(keyword);
                 currentStep += keyword->getRecord(0)->getItem(0)->size(); // This is a bit weird API.
-            }
+                break;
 
-            if (keyword->name() == "WELSPECS") {
+            case ParserKeywords::WELSPECS::keywordId:
                 handleWELSPECS(section, keyword, currentStep);
-            }
+                break;
 
-            if (keyword->name() == "WCONHIST")
+            case ParserKeywords::WCONHIST::keywordId:
                 handleWCONHIST(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "WCONPROD")
+            case ParserKeywords::WCONPROD::keywordId:
                 handleWCONPROD(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "WCONINJE")
+            case ParserKeywords::WCONINJE::keywordId:
                 handleWCONINJE(section, keyword, currentStep);
+                break;
 
-            if (keyword->name() == "WPOLYMER")
+            case ParserKeywords::WPOLYMER::keywordId:
                 handleWPOLYMER(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "WSOLVENT")
+            case ParserKeywords::WSOLVENT::keywordId:
                 handleWSOLVENT(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "WCONINJH")
+            case ParserKeywords::WCONINJH::keywordId:
                 handleWCONINJH(section, keyword, currentStep);
+                break;
 
-            if (keyword->name() == "WGRUPCON")
+            case ParserKeywords::WGRUPCON::keywordId:
                 handleWGRUPCON(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "COMPDAT")
+            case ParserKeywords::COMPDAT::keywordId:
                 handleCOMPDAT(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "WELSEGS")
+            case ParserKeywords::WELSEGS::keywordId:
                 handleWELSEGS(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "COMPSEGS")
+            case ParserKeywords::COMPSEGS::keywordId:
                 handleCOMPSEGS(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "WELOPEN")
+            case ParserKeywords::WELOPEN::keywordId:
                 handleWELOPEN(keyword, currentStep , section->hasKeyword("COMPLUMP"));
+                break;
 
-            if (keyword->name() == "WELTARG")
+            case ParserKeywords::WELTARG::keywordId:
                 handleWELTARG(section, keyword, currentStep);
+                break;
 
-            if (keyword->name() == "GRUPTREE")
+            case ParserKeywords::GRUPTREE::keywordId:
                 handleGRUPTREE(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "GCONINJE")
+            case ParserKeywords::GCONINJE::keywordId:
                 handleGCONINJE(section, keyword, currentStep);
+                break;
 
-            if (keyword->name() == "GCONPROD")
+            case ParserKeywords::GCONPROD::keywordId:
                 handleGCONPROD(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "TUNING")
+            case ParserKeywords::TUNING::keywordId:
                 handleTUNING(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "NOSIM")
+            case ParserKeywords::NOSIM::keywordId:
                 handleNOSIM();
+                break;
 
-            if (keyword->name() == "RPTRST")
+            case ParserKeywords::RPTRST::keywordId:
+            case ParserKeywords::RPTSCHED::keywordId:
                 IOConfigSettings.push_back( std::make_pair( keyword , currentStep ));
+                break;
 
-            if (keyword->name() == "RPTSCHED")
-                IOConfigSettings.push_back( std::make_pair( keyword , currentStep ));
-
-            if (keyword->name() == "WRFT")
-                rftProperties.push_back( std::make_pair( keyword , currentStep ));
-
-            if (keyword->name() == "WRFTPLT")
+            case ParserKeywords::WRFT::keywordId:
+            case ParserKeywords::WRFTPLT::keywordId:
                 rftProperties.push_back( std::make_pair( keyword , currentStep ));
+                break;
 
-            if (keyword->name() == "WPIMULT")
+            case ParserKeywords::WPIMULT::keywordId:
                 handleWPIMULT(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "COMPORD")
+            case ParserKeywords::COMPORD::keywordId:
                 handleCOMPORD(parseMode , keyword, currentStep);
+                break;
 
-            if (keyword->name() == "DRSDT")
+            case ParserKeywords::DRSDT::keywordId:
                 handleDRSDT(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "DRVDT")
+            case ParserKeywords::DRVDT::keywordId:
                 handleDRVDT(keyword, currentStep);
+                break;
 
-            if (keyword->name() == "VAPPARS")
+            case ParserKeywords::VAPPARS::keywordId:
                 handleVAPPARS(keyword, currentStep);
+                break;
 
+            case ParserKeywords::MULTFLT::keywordId:
+                handleMULTFLT(keyword, currentStep);
+                break;
+
+            default:
+                break;
+            }
 
             if (geoModifiers.find( keyword->name() ) != geoModifiers.end()) {
                 bool supported = geoModifiers.at( keyword->name() );
@@ -378,6 +406,21 @@ namespace Opm {
     }
 
 
+    void Schedule::handleMULTFLT(DeckKeywordConstPtr keyword, size_t currentStep) {
+        for (size_t recordNr = 0; recordNr < keyword->size(); recordNr++) {
+            DeckRecordConstPtr record = keyword->getRecord(recordNr);
+            const std::string& faultName = record->getItem<ParserKeywords::MULTFLT::fault>()->getString(0);
+            double factor = record->getItem<ParserKeywords::MULTFLT::factor>()->getRawDouble(0);
+
+            if (m_faultMultipliers.count( faultName ) == 0)
+                m_faultMultipliers[faultName] = std::make_shared<DynamicState<double> >( m_timeMap , 1.0 );
+
+            auto& multipliers = m_faultMultipliers.at( faultName );
+            multipliers->update( currentStep , multipliers->get( currentStep ) * factor );
+        }
+    }
+
+
 
     void Schedule::checkWELSPECSConsistency(WellConstPtr well, DeckKeywordConstPtr keyword, size_t recordIdx) const {
         DeckRecordConstPtr record = keyword->getRecord(recordIdx);
@@ -1625,6 +1668,30 @@ namespace Opm {
     }
 
 
+    bool Schedule::hasFaultMultipliers() const {
+        return !m_faultMultipliers.empty();
+    }
+
+
+    std::vector<std::string> Schedule::getFaultMultiplierNames() const {
+        std::vector<std::string> faultNames;
+        for (const auto& pair : m_faultMultipliers)
+            faultNames.push_back( pair.first );
+        return faultNames;
+    }
+
+
+    double Schedule::getFaultMultiplier(const std::string& faultName , size_t timeStep) const {
+        auto iter = m_faultMultipliers.find( faultName );
+        if (iter == m_faultMultipliers.end()) {
+            if (timeStep >= m_timeMap->size())
+                throw std::range_error("Index value is out range.");
+            return 1.0;
+        }
+        return iter->second->get( timeStep );
+    }
+
+
     const Events& Schedule::getEvents() const {
         return *m_events;
     }
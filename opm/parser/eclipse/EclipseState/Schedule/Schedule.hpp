@@ -73,6 +73,16 @@ namespace Opm
         bool hasOilVaporizationProperties();
         std::shared_ptr<const Deck> getModifierDeck(size_t timeStep) const;
 
+        /*
+          The MULTFLT keywords in the SCHEDULE section multiply the
+          current multiplier of the fault; getFaultMultiplier() is the
+          product of all the SCHEDULE factors of the fault up to and
+          including timeStep, i.e. 1.0 before the first one.
+        */
+        bool hasFaultMultipliers() const;
+        std::vector<std::string> getFaultMultiplierNames() const;
+        double getFaultMultiplier(const std::string& faultName , size_t timeStep) const;
+
 
 
     private:
@@ -84,6 +94,7 @@ namespace Opm
         std::shared_ptr<DynamicState<OilVaporizationPropertiesPtr> > m_oilvaporizationproperties;
         std::shared_ptr<Events> m_events;
         std::shared_ptr<DynamicVector<std::shared_ptr<Deck> > > m_modifierDeck;
+        std::map<std::string , std::shared_ptr<DynamicState<double> > > m_faultMultipliers;
         TuningPtr m_tuning;
         bool nosim;
 
@@ -130,6 +141,7 @@ namespace Opm
         void handleDRSDT(DeckKeywordConstPtr keyword, size_t currentStep);
         void handleDRVDT(DeckKeywordConstPtr keyword, size_t currentStep);
         void handleVAPPARS(DeckKeywordConstPtr keyword, size_t currentStep);
+        void handleMULTFLT(DeckKeywordConstPtr keyword, size_t currentStep);
 
         void checkUnhandledKeywords(std::shared_ptr<const SCHEDULESection> section) const;
 
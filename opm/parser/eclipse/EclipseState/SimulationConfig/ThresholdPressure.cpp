@@ -91,8 +91,10 @@ namespace Opm {
             //Find max of eqlnum
             if (hasEqlnumKeyword) {
                 auto eqlnumKeyword = gridProperties->getKeyword<ParserKeywords::EQLNUM>( );
-                auto eqlnum = eqlnumKeyword->getData();
-                maxEqlnum = *std::max_element(eqlnum.begin(), eqlnum.end());
+                // iget() does not expand a compressed EQLNUM
+                maxEqlnum = eqlnumKeyword->iget(0);
+                for (size_t g = 1; g < eqlnumKeyword->getCartesianSize(); g++)
+                    maxEqlnum = std::max( maxEqlnum , eqlnumKeyword->iget(g) );
 
                 if (0 == maxEqlnum) {
                     throw std::runtime_error("Error in EQLNUM data: all values are 0");
@@ -274,8 +274,11 @@ BOOST_AUTO_TEST_CASE(GetProperty) {
     std::shared_ptr<GridProperty<int> > satNUM = state.getIntGridProperty( "SATNUM" );
 
     BOOST_CHECK_EQUAL(1000U , satNUM->getCartesianSize() );
+    // the region properties are held compressed until getData()
+    BOOST_CHECK( satNUM->isConstant() );
     for (size_t i=0; i < satNUM->getCartesianSize(); i++)
         BOOST_CHECK_EQUAL( 2 , satNUM->iget(i) );
+    BOOST_CHECK_EQUAL( 2 , satNUM->getData()[999] );
 
     BOOST_CHECK_THROW( satNUM->iget(100000) , std::invalid_argument);
 }
@@ -577,3 +580,64 @@ BOOST_AUTO_TEST_CASE(TestIOConfigCreationWithSolutionRPTSOL) {
         BOOST_CHECK_EQUAL(true, ioConfig->getWriteRestartFile(0));
     }
 }
+
+
+static DeckPtr createDeckMinpvPinch() {
+    const char *deckData =
+        "RUNSPEC\n"
+        "\n"
+        "DIMENS\n"
+        " 1 1 5 /\n"
+        "GRID\n"
+        "DX\n"
+        "5*1 /\n"
+        "DY\n"
+        "5*1 /\n"
+        "DZ\n"
+        "1 0.1 1 0.1 1 /\n"
+        "TOPS\n"
+        "0 /\n"
+        "ACTNUM\n"
+        "1 0 1 1 1 /\n"
+        "PORO\n"
+        "0.2 0.2 0.2 0.01 0.2 /\n"
+        "PERMZ\n"
+        "5*100 /\n"
+        "MINPV\n"
+        "  0.05 /\n"
+        "PINCH\n"
+        "  0.5 /\n"
+        "EDIT\n"
+        "\n";
+
+    ParserPtr parser(new Parser());
+    return parser->parseString(deckData, ParseMode()) ;
+}
+
+
+BOOST_AUTO_TEST_CASE(MinpvAndPinchNNC) {
+    DeckPtr deck = createDeckMinpvPinch();
+    EclipseState state(deck , ParseMode());
+    auto grid = state.getEclipseGrid();
+    auto nnc = state.getPinchNNC();
+    const std::vector<int> minpvActnum = { 1 , 0 , 1 , 0 , 1 };
+    const std::vector<int>& actnum = state.getMinpvActnum();
+
+    // The MINPV cells are inactive in the grid as well.
+    BOOST_CHECK_EQUAL( 3U , grid->getNumActive() );
+    BOOST_CHECK( !grid->cellActive( 3 ));
+    BOOST_CHECK_EQUAL( 3U , grid->getActiveToGlobal().size() );
+    BOOST_CHECK_EQUAL( 4U , grid->getActiveToGlobal()[2] );
+    BOOST_CHECK_EQUAL( 3U , state.getDoubleGridProperty("PORO")->getEclKW( grid ).size() );
+    BOOST_CHECK_EQUAL_COLLECTIONS( minpvActnum.begin() , minpvActnum.end() , actnum.begin() , actnum.end() );
+
+    BOOST_CHECK_EQUAL( 0U , state.getNNC()->numNNC() );
+    BOOST_CHECK_EQUAL( 2U , nnc->numNNC() );
+    BOOST_CHECK_EQUAL( 0U , nnc->nnc1()[0] );
+    BOOST_CHECK_EQUAL( 2U , nnc->nnc2()[0] );
+    BOOST_CHECK_EQUAL( 2U , nnc->nnc1()[1] );
+    BOOST_CHECK_EQUAL( 4U , nnc->nnc2()[1] );
+
+    // Two cells of 1x1x1 with the same PERMZ.
+    BOOST_CHECK_CLOSE( 100 * Metric::Permeability , nnc->trans()[1] , 1e-8 );
+}
@@ -59,7 +59,10 @@ namespace Opm {
 
 
     std::string KeywordGenerator::sourceHeader() {
-        std::string header = "#include <opm/parser/eclipse/Parser/ParserKeyword.hpp>\n"
+        std::string header = "#include <algorithm>\n"
+            "#include <iterator>\n"
+            "#include <utility>\n"
+            "#include <opm/parser/eclipse/Parser/ParserKeyword.hpp>\n"
             "#include <opm/parser/eclipse/Parser/ParserItem.hpp>\n"
             "#include <opm/parser/eclipse/Parser/ParserIntItem.hpp>\n"
             "#include <opm/parser/eclipse/Parser/ParserStringItem.hpp>\n"
@@ -113,14 +116,58 @@ namespace Opm {
     }
 
 
+    /*
+      The keywords are numbered in the (sorted) order of the loader, so
+      the header and the source agree on the ids, and the ids only
+      change when keywords are added or removed.
+    */
+    void KeywordGenerator::assignKeywordIds(const KeywordLoader& loader) {
+        int keywordId = 0;
+        for (auto iter = loader.keyword_begin(); iter != loader.keyword_end(); ++iter)
+            (*iter).second->setKeywordId( keywordId++ );
+    }
+
+
     bool KeywordGenerator::updateSource(const KeywordLoader& loader , const std::string& sourceFile) const {
         std::stringstream newSource;
 
+        assignKeywordIds( loader );
         newSource << sourceHeader();
         for (auto iter = loader.keyword_begin(); iter != loader.keyword_end(); ++iter) {
             std::shared_ptr<ParserKeyword> keyword = (*iter).second;
             newSource << keyword->createCode() << std::endl;
         }
+
+        {
+            std::map<std::string , int> deckNameIds;
+            for (auto iter = loader.keyword_begin(); iter != loader.keyword_end(); ++iter) {
+                std::shared_ptr<ParserKeyword> keyword = (*iter).second;
+                for (auto deckName = keyword->deckNamesBegin(); deckName != keyword->deckNamesEnd(); ++deckName)
+                    deckNameIds[*deckName] = keyword->getKeywordId();
+            }
+
+            newSource << "namespace {" << std::endl;
+            newSource << "    // sorted by deck name" << std::endl;
+            newSource << "    const std::pair<const char* , int> deckNameIds[] = {" << std::endl;
+            for (const auto& deckNameId : deckNameIds)
+                newSource << "        { \"" << deckNameId.first << "\" , " << deckNameId.second << " }," << std::endl;
+            newSource << "    };" << std::endl;
+            newSource << "}" << std::endl << std::endl;
+
+            newSource << "int getKeywordId(const std::string& deckName) {" << std::endl;
+            newSource << "    auto iter = std::lower_bound( std::begin( deckNameIds ) , std::end( deckNameIds ) , deckName ," << std::endl;
+            newSource << "                                  [](const std::pair<const char* , int>& entry , const std::string& name) { return name.compare( entry.first ) > 0; });" << std::endl;
+            newSource << "    if (iter != std::end( deckNameIds ) && deckName == iter->first)" << std::endl;
+            newSource << "        return iter->second;" << std::endl;
+            newSource << "    return -1;" << std::endl;
+            newSource << "}" << std::endl << std::endl;
+
+            newSource << "int getKeywordId(const DeckKeyword& deckKeyword) {" << std::endl;
+            newSource << "    if (deckKeyword.getKeywordId() >= 0)" << std::endl;
+            newSource << "        return deckKeyword.getKeywordId();" << std::endl;
+            newSource << "    return getKeywordId( deckKeyword.name() );" << std::endl;
+            newSource << "}" << std::endl << std::endl;
+        }
         newSource << "}" << std::endl;
         {
             newSource << "void Parser::addDefaultKeywords() {" << std::endl;
@@ -148,11 +195,19 @@ namespace Opm {
     bool KeywordGenerator::updateHeader(const KeywordLoader& loader , const std::string& headerFile) const {
         std::stringstream stream;
 
+        assignKeywordIds( loader );
         stream << headerHeader();
         for (auto iter = loader.keyword_begin(); iter != loader.keyword_end(); ++iter) {
             std::shared_ptr<ParserKeyword> keyword = (*iter).second;
             stream << keyword->createDeclaration("   ") << std::endl;
         }
+        stream << "   // the keyword ids are 0, 1, ..., numKeywordIds - 1" << std::endl;
+        stream << "   const int numKeywordIds = " << loader.size() << ";" << std::endl << std::endl;
+        stream << "   // The keywordId of the generated keyword with the given deck name, or -1." << std::endl;
+        stream << "   int getKeywordId(const std::string& deckName);" << std::endl << std::endl;
+        stream << "   // As DeckKeyword::getKeywordId(), but keywords without a generated parser" << std::endl;
+        stream << "   // keyword are looked up by name." << std::endl;
+        stream << "   int getKeywordId(const DeckKeyword& deckKeyword);" << std::endl;
         stream << "}" << std::endl << "}" << std::endl;
         stream << "#endif" << std::endl;
 
@@ -46,6 +46,8 @@ namespace Opm {
         bool updateTest(const KeywordLoader& loader , const std::string& testFile) const;
 
     private:
+        static void assignKeywordIds(const KeywordLoader& loader);
+
         bool m_verbose;
     };
 }
@@ -109,3 +109,33 @@ BOOST_AUTO_TEST_CASE(ExportFromCPGridACTNUM) {
     }
 }
 
+
+
+
+BOOST_AUTO_TEST_CASE(CornerPointGeometryAsERT) {
+    ParserPtr parser(new Parser());
+    const std::vector<std::string> deckFiles = { "testdata/integration_tests/GRID/CORNERPOINT.DATA" ,
+                                                 "testdata/integration_tests/GRID/CORNERPOINT_ACTNUM.DATA" };
+
+    for (const auto& deckFile : deckFiles) {
+        DeckPtr deck =  parser->parseFile(deckFile, ParseMode());
+        std::shared_ptr<EclipseGrid> grid(new EclipseGrid( deck ));
+        const ecl_grid_type * ecl_grid = grid->c_ptr();
+        std::vector<double> centerX , centerY , centerZ , depth , volume , thickness;
+        grid->getCornerPointGeometry().computeCellGeometry( centerX , centerY , centerZ , depth , volume , thickness );
+
+        BOOST_CHECK_EQUAL( &deck->getKeyword("ZCORN")->getSIDoubleData() , &grid->getCornerPointGeometry().getZCORN() );
+        for (size_t g = 0; g < grid->getCartesianSize(); g++) {
+            const int globalIndex = static_cast<int>(g);
+            double x , y , z;
+            ecl_grid_get_xyz1( ecl_grid , globalIndex , &x , &y , &z );
+
+            BOOST_CHECK_CLOSE( x , centerX[g] , 0.001 );
+            BOOST_CHECK_CLOSE( y , centerY[g] , 0.001 );
+            BOOST_CHECK_CLOSE( z , centerZ[g] , 0.001 );
+            BOOST_CHECK_CLOSE( ecl_grid_get_cdepth1( ecl_grid , globalIndex ) , depth[g] , 0.001 );
+            BOOST_CHECK_CLOSE( ecl_grid_get_cell_volume1( ecl_grid , globalIndex ) , volume[g] , 0.01 );
+            BOOST_CHECK_CLOSE( ecl_grid_get_cell_thickness1( ecl_grid , globalIndex ) , thickness[g] , 0.001 );
+        }
+    }
+}
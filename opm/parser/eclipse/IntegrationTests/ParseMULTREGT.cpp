@@ -97,3 +97,36 @@ BOOST_AUTO_TEST_CASE( MULTREGT_ECLIPSE_STATE ) {
     BOOST_CHECK_EQUAL( 0.60 , transMult->getRegionMultiplier( 3 , 7 , FaceDir::DirEnum::ZPlus));
 
 }
+
+
+BOOST_AUTO_TEST_CASE( MULTREGT_BULK_MULTIPLIERS ) {
+    ParseMode parseMode;
+    ParserPtr parser(new Parser());
+    DeckPtr deck =  parser->parseFile("testdata/integration_tests/MULTREGT/MULTREGT.DATA", parseMode);
+    EclipseState state(deck , parseMode);
+    auto transMult = state.getTransMult();
+    auto grid = state.getEclipseGrid();
+    const size_t nx = grid->getNX();
+    const size_t ny = grid->getNY();
+    const size_t nz = grid->getNZ();
+
+    std::vector<double> multX , multY , multZ;
+    transMult->getRegionMultipliers( FaceDir::DirEnum::XPlus , multX );
+    transMult->getRegionMultipliers( FaceDir::DirEnum::YPlus , multY );
+    transMult->getRegionMultipliers( FaceDir::DirEnum::ZPlus , multZ );
+    BOOST_CHECK_EQUAL( grid->getCartesianSize() , multX.size() );
+    BOOST_CHECK_EQUAL( 0.10 , multX[0] );
+
+    for (size_t k = 0; k < nz; k++) {
+        for (size_t j = 0; j < ny; j++) {
+            for (size_t i = 0; i < nx; i++) {
+                size_t g = grid->getGlobalIndex( i , j , k );
+                BOOST_CHECK_EQUAL( (i + 1 < nx) ? transMult->getRegionMultiplier( g , g + 1 , FaceDir::DirEnum::XPlus ) : 1.0 , multX[g] );
+                BOOST_CHECK_EQUAL( (j + 1 < ny) ? transMult->getRegionMultiplier( g , g + nx , FaceDir::DirEnum::YPlus ) : 1.0 , multY[g] );
+                BOOST_CHECK_EQUAL( (k + 1 < nz) ? transMult->getRegionMultiplier( g , g + nx * ny , FaceDir::DirEnum::ZPlus ) : 1.0 , multZ[g] );
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW( transMult->getRegionMultipliers( FaceDir::DirEnum::XMinus , multX ) , std::invalid_argument );
+}
@@ -28,6 +28,7 @@
 #include <opm/parser/eclipse/Parser/ParseMode.hpp>
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/FaultMultiplierHistory.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/ScheduleEnums.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/CompletionSet.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Events.hpp>
@@ -57,3 +58,115 @@ BOOST_AUTO_TEST_CASE(MULTFLT_IN_SCHEDULE) {
     BOOST_CHECK_EQUAL( 2.00 , trans->getMultiplier( 2,2,0,FaceDir::XPlus ));
     BOOST_CHECK_EQUAL( 0.10 , trans->getMultiplier( 3,2,0,FaceDir::XPlus ));
 }
+
+
+BOOST_AUTO_TEST_CASE(MULTFLT_HISTORY) {
+    ParserPtr parser(new Parser());
+    boost::filesystem::path scheduleFile("testdata/integration_tests/TRANS/Deck1");
+    ParseMode parseMode;
+    DeckPtr deck =  parser->parseFile(scheduleFile.string(), parseMode);
+    std::shared_ptr<EclipseState> eclState = std::make_shared<EclipseState>( deck , parseMode );
+    std::shared_ptr<const TransMult> trans = eclState->getTransMult();
+    std::shared_ptr<const Schedule> schedule = eclState->getSchedule();
+    std::shared_ptr<const FaultMultiplierHistory> history = eclState->getFaultMultiplierHistory();
+
+    BOOST_CHECK( schedule->hasFaultMultipliers() );
+    BOOST_CHECK_EQUAL( 1.0  , schedule->getFaultMultiplier( "F1" , 2 ));
+    BOOST_CHECK_EQUAL( 20.0 , schedule->getFaultMultiplier( "F1" , 3 ));
+    BOOST_CHECK_EQUAL( 20.0 , schedule->getFaultMultiplier( "F1" , 8 ));
+    BOOST_CHECK_EQUAL( 1.0  , schedule->getFaultMultiplier( "F2" , 8 ));
+
+    BOOST_CHECK_EQUAL( 1U , history->numFaults() );
+    BOOST_CHECK_EQUAL( "F1" , history->getFaultName( 0 ));
+    BOOST_CHECK_EQUAL( 5U , history->numFaces() );
+    BOOST_CHECK_EQUAL( 20.0 , history->getFaultMultiplier( 0 , 4 ));
+    BOOST_CHECK_THROW( history->getChanges( 0 , history->numTimeSteps() ) , std::invalid_argument );
+
+    BOOST_CHECK_EQUAL( 0U , history->getChanges( 0 , 2 ).size() );
+    BOOST_CHECK_EQUAL( 0U , history->getChanges( 3 , 8 ).size() );
+    {
+        const auto changes = history->getChanges( 2 , 3 );
+        BOOST_CHECK_EQUAL( 5U , changes.size() );
+        for (size_t j = 0; j < changes.size(); j++) {
+            BOOST_CHECK_EQUAL( FaceDir::XPlus , changes[j].faceDir );
+            BOOST_CHECK_EQUAL( 2 + 5 * j , changes[j].globalIndex );
+            BOOST_CHECK_CLOSE( 2.0 , changes[j].multiplier , 1e-10 );
+        }
+
+        const auto reverse = history->getChanges( 3 , 0 );
+        BOOST_CHECK_EQUAL( 5U , reverse.size() );
+        BOOST_CHECK_CLOSE( 0.1 , reverse[0].multiplier , 1e-10 );
+
+        // The same result as applying the modifier deck.
+        eclState->applyModifierDeck( schedule->getModifierDeck(3) );
+        std::shared_ptr<const std::vector<double> > faceMultPtr = trans->getFaceMultipliers( FaceDir::XPlus );
+        const std::vector<double>& faceMult = *faceMultPtr;
+        for (const auto& change : changes)
+            BOOST_CHECK_EQUAL( faceMult[change.globalIndex] , change.multiplier );
+    }
+}
+
+
+static DeckPtr createBothSidesFaultDeck(const std::string& fault) {
+    const std::string deckData =
+        "START\n"
+        "10 MAI 2007 /\n"
+        "RUNSPEC\n"
+        "DIMENS\n"
+        " 2 1 1 /\n"
+        "GRID\n"
+        "FAULTS\n"
+        "   'F1'  1  1   1  1  1  1  'X' /\n"
+        "   'F1'  2  2   1  1  1  1  'X-' /\n"
+        "/\n"
+        "SCHEDULE\n"
+        "DATES\n"
+        "  10  'JUN'  2007 /\n"
+        "/\n"
+        "MULTFLT\n"
+        "   '" + fault + "' 2.0  /\n"
+        "/\n"
+        "DATES\n"
+        "  10  JLY 2007 /\n"
+        "/\n";
+
+    ParserPtr parser(new Parser());
+    return parser->parseString( deckData , ParseMode() );
+}
+
+
+BOOST_AUTO_TEST_CASE(MULTFLT_HISTORY_BOTH_SIDES) {
+    DeckPtr deck = createBothSidesFaultDeck( "F1" );
+    ParseMode parseMode;
+    std::shared_ptr<EclipseState> eclState = std::make_shared<EclipseState>( deck , parseMode );
+    std::shared_ptr<const TransMult> trans = eclState->getTransMult();
+    std::shared_ptr<const Schedule> schedule = eclState->getSchedule();
+    std::shared_ptr<const FaultMultiplierHistory> history = eclState->getFaultMultiplierHistory();
+
+    BOOST_CHECK_EQUAL( 1U , history->numFaults() );
+    BOOST_CHECK_EQUAL( 1U , history->numFaces() );
+
+    // The face is listed from both sides and gets the factor twice, as with the modifier deck.
+    const auto changes = history->getChanges( 0 , 1 );
+    BOOST_CHECK_EQUAL( 1U , changes.size() );
+    BOOST_CHECK_EQUAL( FaceDir::XPlus , changes[0].faceDir );
+    BOOST_CHECK_EQUAL( 0U , changes[0].globalIndex );
+    BOOST_CHECK_CLOSE( 4.0 , changes[0].multiplier , 1e-10 );
+
+    eclState->applyModifierDeck( schedule->getModifierDeck(1) );
+    BOOST_CHECK_EQUAL( (*trans->getFaceMultipliers( FaceDir::XPlus ))[0] , changes[0].multiplier );
+
+}
+
+
+BOOST_AUTO_TEST_CASE(MULTFLT_HISTORY_UNKNOWN_FAULT) {
+    DeckPtr deck = createBothSidesFaultDeck( "F9" );
+    ParseMode parseMode;
+
+    // Only a warning by default; the fault is left out.
+    EclipseState eclState( deck , parseMode );
+    BOOST_CHECK_EQUAL( 0U , eclState.getFaultMultiplierHistory()->numFaults() );
+
+    parseMode.updateKey( ParseMode::SCHEDULE_MULTFLT_UNKNOWN_FAULT , InputError::THROW_EXCEPTION );
+    BOOST_CHECK_THROW( EclipseState( deck , parseMode ) , std::invalid_argument );
+}
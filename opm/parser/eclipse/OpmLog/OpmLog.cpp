@@ -16,6 +16,7 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 
@@ -24,6 +25,12 @@
 
 namespace Opm {
 
+    /*
+      Serializes addMessage(); messages can be added from the worker
+      threads used when parsing INCLUDE files in parallel.
+    */
+    static std::mutex messageMutex;
+
 
     std::shared_ptr<Logger> OpmLog::getLogger() {
         if (!m_logger)
@@ -34,6 +41,7 @@ namespace Opm {
 
 
     void OpmLog::addMessage(int64_t messageFlag , const std::string& message) {
+        std::lock_guard<std::mutex> lock( messageMutex );
         if (m_logger)
             m_logger->addMessage( messageFlag , message );
     }
@@ -30,7 +30,8 @@ namespace Opm {
 
 /*
   The OpmLog class is a fully static class which manages a proper
-  Logger instance.
+  Logger instance. addMessage() can safely be called from several
+  threads; configuring the backends is not thread safe.
 */
 
 
@@ -0,0 +1,145 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+#include <utility>
+
+#include <opm/parser/eclipse/OpmLog/OpmLog.hpp>
+#include <opm/parser/eclipse/OpmLog/ProfileLog.hpp>
+
+
+namespace Opm {
+
+const std::string ProfileLog::BackendName = "ProfileLog";
+
+
+ProfileLog::Timer::Timer(std::shared_ptr<ProfileLog> profileLog , const std::string& category) :
+    m_profileLog( profileLog ),
+    m_category( category )
+{
+    if (m_profileLog)
+        m_start = std::chrono::steady_clock::now();
+}
+
+
+void ProfileLog::Timer::lap(const std::string& name) {
+    if (!m_profileLog)
+        return;
+
+    auto stop = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed = stop - m_start;
+    m_profileLog->addSample( m_category , name , elapsed.count() );
+    m_start = stop;
+}
+
+
+/*
+  The mask is zero: the ProfileLog is fed through addSample(), not
+  with messages.
+*/
+ProfileLog::ProfileLog() : LogBackend(0)
+{ }
+
+
+std::shared_ptr<ProfileLog> ProfileLog::getActive() {
+    if (OpmLog::hasBackend( BackendName ))
+        return OpmLog::getBackend<ProfileLog>( BackendName );
+    else
+        return std::shared_ptr<ProfileLog>();
+}
+
+
+void ProfileLog::addSample(const std::string& category , const std::string& name , double seconds ,
+                           size_t bytes , size_t records , size_t values) {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    Sample& sample = m_samples[category][name];
+    sample.count++;
+    sample.seconds += seconds;
+    sample.bytes += bytes;
+    sample.records += records;
+    sample.values += values;
+}
+
+
+bool ProfileLog::hasSample(const std::string& category , const std::string& name) const {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    auto iter = m_samples.find( category );
+    return iter != m_samples.end() && iter->second.count( name ) > 0;
+}
+
+
+ProfileLog::Sample ProfileLog::getSample(const std::string& category , const std::string& name) const {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    auto iter = m_samples.find( category );
+    if (iter == m_samples.end() || iter->second.count( name ) == 0)
+        throw std::invalid_argument("No profile sample for " + category + ": " + name);
+
+    return iter->second.at( name );
+}
+
+
+std::vector<std::string> ProfileLog::getCategories() const {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    std::vector<std::string> categories;
+    for (const auto& pair : m_samples)
+        categories.push_back( pair.first );
+    return categories;
+}
+
+
+void ProfileLog::printReport(std::ostream& os , size_t maxRows) const {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    for (const auto& category : m_samples) {
+        std::vector<std::pair<std::string , Sample> > rows( category.second.begin() , category.second.end() );
+        std::sort( rows.begin() , rows.end() , [](const std::pair<std::string , Sample>& row1 , const std::pair<std::string , Sample>& row2) {
+                return row1.second.seconds > row2.second.seconds;
+            });
+
+        double totalSeconds = 0;
+        for (const auto& row : rows)
+            totalSeconds += row.second.seconds;
+
+        os << "Profile " << category.first << ": " << rows.size() << " entries, " << std::fixed << std::setprecision(3) << totalSeconds << " s" << std::endl;
+        os << "  " << std::left << std::setw(32) << "name" << std::right
+           << std::setw(8) << "count" << std::setw(12) << "seconds" << std::setw(8) << "%"
+           << std::setw(12) << "bytes" << std::setw(12) << "records" << std::setw(14) << "values" << std::endl;
+
+        for (size_t index = 0; index < std::min( maxRows , rows.size() ); index++) {
+            const Sample& sample = rows[index].second;
+            os << "  " << std::left << std::setw(32) << rows[index].first << std::right
+               << std::setw(8) << sample.count
+               << std::setw(12) << std::setprecision(4) << sample.seconds
+               << std::setw(8) << std::setprecision(1) << (totalSeconds > 0 ? 100 * sample.seconds / totalSeconds : 0)
+               << std::setw(12) << sample.bytes << std::setw(12) << sample.records << std::setw(14) << sample.values << std::endl;
+        }
+        if (rows.size() > maxRows)
+            os << "  ... " << rows.size() - maxRows << " more" << std::endl;
+        os << std::endl;
+    }
+}
+
+
+void ProfileLog::clear() {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_samples.clear();
+}
+
+
+} // namespace Opm
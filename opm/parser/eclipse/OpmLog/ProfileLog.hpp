@@ -0,0 +1,98 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef OPM_PROFILELOG_HPP
+#define OPM_PROFILELOG_HPP
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/OpmLog/LogBackend.hpp>
+
+namespace Opm {
+
+/*!
+ * \brief Aggregated profile of the deck processing.
+ *
+ * When a ProfileLog is added to OpmLog under the name BackendName the
+ * Parser records the wall time, the input bytes and the records and
+ * values produced for every keyword and every input file, and the
+ * EclipseState records the time of its init steps. The samples are
+ * aggregated per category ("keyword", "file", "EclipseState") and
+ * name; without the backend nothing is recorded. The ProfileLog does
+ * not take ordinary log messages.
+ */
+class ProfileLog : public LogBackend {
+public:
+    static const std::string BackendName;
+
+    struct Sample {
+        size_t count = 0;
+        double seconds = 0;
+        size_t bytes = 0;
+        size_t records = 0;
+        size_t values = 0;
+    };
+
+    /*
+      Records the time between the laps in a category, e.g. the init
+      steps of a constructor; does nothing for a null ProfileLog.
+    */
+    class Timer {
+    public:
+        Timer(std::shared_ptr<ProfileLog> profileLog , const std::string& category);
+        void lap(const std::string& name);
+    private:
+        std::shared_ptr<ProfileLog> m_profileLog;
+        std::string m_category;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    ProfileLog();
+
+    // The ProfileLog added to OpmLog, or null when profiling is not enabled.
+    static std::shared_ptr<ProfileLog> getActive();
+
+    // Thread safe; the INCLUDE files can be parsed in parallel.
+    void addSample(const std::string& category , const std::string& name , double seconds ,
+                   size_t bytes = 0 , size_t records = 0 , size_t values = 0);
+
+    bool hasSample(const std::string& category , const std::string& name) const;
+    Sample getSample(const std::string& category , const std::string& name) const;
+    std::vector<std::string> getCategories() const;
+
+    // The samples of every category, the most expensive first.
+    void printReport(std::ostream& os , size_t maxRows = 20) const;
+
+    void clear();
+    ~ProfileLog() {};
+private:
+    mutable std::mutex m_mutex;
+    std::map<std::string , std::map<std::string , Sample> > m_samples;
+};
+
+typedef std::shared_ptr<ProfileLog> ProfileLogPtr;
+typedef std::shared_ptr<const ProfileLog> ProfileLogConstPtr;
+} // namespace Opm
+
+#endif
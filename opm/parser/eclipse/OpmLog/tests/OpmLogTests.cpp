@@ -32,6 +32,7 @@
 #include <opm/parser/eclipse/OpmLog/LogBackend.hpp>
 #include <opm/parser/eclipse/OpmLog/CounterLog.hpp>
 #include <opm/parser/eclipse/OpmLog/TimerLog.hpp>
+#include <opm/parser/eclipse/OpmLog/ProfileLog.hpp>
 #include <opm/parser/eclipse/OpmLog/StreamLog.hpp>
 #include <opm/parser/eclipse/OpmLog/LogUtil.hpp>
 
@@ -248,3 +249,46 @@ BOOST_AUTO_TEST_CASE(TestOpmLog) {
 
     BOOST_CHECK_EQUAL( log_stream.str() , "Warning\n");
 }
+
+
+
+BOOST_AUTO_TEST_CASE(TestProfileLog) {
+    std::shared_ptr<ProfileLog> profileLog = std::make_shared<ProfileLog>();
+    profileLog->addSample( "keyword" , "PORO" , 0.5 , 100 , 1 , 10 );
+    profileLog->addSample( "keyword" , "PORO" , 0.25 , 50 , 1 , 5 );
+    profileLog->addSample( "keyword" , "DX" , 0.125 );
+
+    BOOST_CHECK( profileLog->hasSample( "keyword" , "PORO" ));
+    BOOST_CHECK( !profileLog->hasSample( "file" , "PORO" ));
+    BOOST_CHECK_THROW( profileLog->getSample( "keyword" , "PERMX" ) , std::invalid_argument );
+
+    ProfileLog::Sample sample = profileLog->getSample( "keyword" , "PORO" );
+    BOOST_CHECK_EQUAL( 2U , sample.count );
+    BOOST_CHECK_EQUAL( 0.75 , sample.seconds );
+    BOOST_CHECK_EQUAL( 150U , sample.bytes );
+    BOOST_CHECK_EQUAL( 2U , sample.records );
+    BOOST_CHECK_EQUAL( 15U , sample.values );
+
+    std::ostringstream report;
+    profileLog->printReport( report , 1 );
+    BOOST_CHECK( report.str().find( "PORO" ) != std::string::npos );
+    BOOST_CHECK( report.str().find( "DX" ) == std::string::npos );
+    BOOST_CHECK( report.str().find( "1 more" ) != std::string::npos );
+
+    // a Timer without a ProfileLog does nothing
+    ProfileLog::Timer disabled( std::shared_ptr<ProfileLog>() , "EclipseState" );
+    disabled.lap( "initGrid" );
+
+    ProfileLog::Timer timer( profileLog , "EclipseState" );
+    timer.lap( "initGrid" );
+    timer.lap( "initGrid" );
+    BOOST_CHECK_EQUAL( 2U , profileLog->getSample( "EclipseState" , "initGrid" ).count );
+
+    BOOST_CHECK( !ProfileLog::getActive() );
+    OpmLog::addBackend( ProfileLog::BackendName , profileLog );
+    BOOST_CHECK_EQUAL( profileLog , ProfileLog::getActive() );
+    OpmLog::removeBackend( ProfileLog::BackendName );
+
+    profileLog->clear();
+    BOOST_CHECK_EQUAL( 0U , profileLog->getCategories().size() );
+}
@@ -0,0 +1,593 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+
+#include <opm/parser/eclipse/Parser/DeckCache.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Deck/DeckRecord.hpp>
+#include <opm/parser/eclipse/Deck/DeckIntItem.hpp>
+#include <opm/parser/eclipse/Deck/DeckFloatItem.hpp>
+#include <opm/parser/eclipse/Deck/DeckDoubleItem.hpp>
+#include <opm/parser/eclipse/Deck/DeckStringItem.hpp>
+#include <opm/parser/eclipse/Units/Dimension.hpp>
+#include <opm/parser/eclipse/OpmLog/OpmLog.hpp>
+
+namespace Opm {
+
+    namespace {
+
+        const char cacheMagic[8] = {'O','P','M','D','E','C','K','\0'};
+        const uint32_t cacheVersion = 2;
+
+        enum ItemType : uint8_t {
+            INT_ITEM = 0,
+            FLOAT_ITEM = 1,
+            DOUBLE_ITEM = 2,
+            STRING_ITEM = 3
+        };
+
+
+        template <typename T>
+        void writeValue(std::ostream& stream , const T& value) {
+            stream.write( reinterpret_cast<const char*>( &value ) , sizeof value );
+        }
+
+        void writeString(std::ostream& stream , const std::string& value) {
+            writeValue<uint64_t>( stream , value.size() );
+            stream.write( value.data() , value.size() );
+        }
+
+        // The numerical data is written as one block of raw bytes.
+        template <typename T>
+        void writeVector(std::ostream& stream , const std::vector<T>& data) {
+            writeValue<uint64_t>( stream , data.size() );
+            if (!data.empty())
+                stream.write( reinterpret_cast<const char*>( data.data() ) , data.size() * sizeof(T) );
+        }
+
+        void writeStrings(std::ostream& stream , const std::vector<std::string>& data) {
+            writeValue<uint64_t>( stream , data.size() );
+            for (const auto& value : data)
+                writeString( stream , value );
+        }
+
+        void writeFlags(std::ostream& stream , const DeckItemDefaultFlags& flags) {
+            std::vector<uint8_t> bytes( flags.size() );
+            for (size_t index = 0; index < flags.size(); index++)
+                bytes[index] = flags[index];
+            writeVector( stream , bytes );
+        }
+
+
+        /*
+          Reads the cache and keeps track of the bytes left in the
+          stream; every length is checked against them before anything
+          is allocated, so a truncated or corrupt cache gives a
+          std::runtime_error and never a huge allocation.
+        */
+        class CacheReader {
+        public:
+            explicit CacheReader(std::istream& stream) :
+                m_stream( stream ),
+                m_remaining( std::numeric_limits<uint64_t>::max() )
+            {
+                std::streampos start = stream.tellg();
+                if (start != std::streampos( -1 )) {
+                    stream.seekg( 0 , std::ios::end );
+                    std::streampos end = stream.tellg();
+                    stream.seekg( start );
+                    if (end != std::streampos( -1 ) && end >= start)
+                        m_remaining = static_cast<uint64_t>( end - start );
+                }
+                checkStream();
+            }
+
+            void read(char* data , uint64_t size) {
+                if (size > m_remaining)
+                    throw std::runtime_error("Deck cache is truncated or corrupt");
+
+                m_stream.read( data , size );
+                checkStream();
+                m_remaining -= size;
+            }
+
+            template <typename T>
+            T readValue() {
+                T value;
+                read( reinterpret_cast<char*>( &value ) , sizeof value );
+                return value;
+            }
+
+            // The number of elements which follow; each takes at least minSize bytes.
+            size_t readLength(uint64_t minSize) {
+                uint64_t length = readValue<uint64_t>();
+                if (length > m_remaining / minSize)
+                    throw std::runtime_error("Deck cache is truncated or corrupt");
+                return static_cast<size_t>( length );
+            }
+
+            std::string readString() {
+                std::string value( readLength( 1 ) , '\0' );
+                if (!value.empty())
+                    read( &value[0] , value.size() );
+                return value;
+            }
+
+            template <typename T>
+            void readVector(std::vector<T>& data) {
+                data.resize( readLength( sizeof(T) ));
+                if (!data.empty())
+                    read( reinterpret_cast<char*>( data.data() ) , data.size() * sizeof(T) );
+            }
+
+            void readStrings(std::vector<std::string>& data) {
+                data.resize( readLength( sizeof(uint64_t) ));
+                for (auto& value : data)
+                    value = readString();
+            }
+
+            void readFlags(DeckItemDefaultFlags& flags) {
+                std::vector<uint8_t> bytes;
+                readVector( bytes );
+                flags = DeckItemDefaultFlags();
+                flags.reserve( bytes.size() );
+                for (auto flag : bytes)
+                    flags.push_back( flag );
+            }
+
+        private:
+            void checkStream() const {
+                if (!m_stream)
+                    throw std::runtime_error("Deck cache is truncated or corrupt");
+            }
+
+            std::istream& m_stream;
+            uint64_t m_remaining;
+        };
+
+
+        /*
+          The header of the cache: the magic, the version, the time the
+          cache was written, the configuration hash and the input files.
+        */
+        std::vector<DeckCache::InputFile> readInputFiles(CacheReader& reader , const std::string& cacheFile , int64_t& cacheTime , uint64_t& configurationHash) {
+            char magic[sizeof cacheMagic];
+            reader.read( magic , sizeof magic );
+            if (std::memcmp( magic , cacheMagic , sizeof magic ) != 0)
+                throw std::runtime_error("The file " + cacheFile + " is not a deck cache");
+
+            if (reader.readValue<uint32_t>() != cacheVersion)
+                throw std::runtime_error("The deck cache " + cacheFile + " has an unsupported version");
+
+            cacheTime = reader.readValue<int64_t>();
+            configurationHash = reader.readValue<uint64_t>();
+
+            std::vector<DeckCache::InputFile> inputFiles( reader.readLength( sizeof(uint64_t) ));
+            for (auto& fileInfo : inputFiles) {
+                fileInfo.path = reader.readString();
+                fileInfo.size = reader.readValue<uint64_t>();
+                fileInfo.modificationTime = reader.readValue<int64_t>();
+                fileInfo.contentHash = reader.readValue<uint64_t>();
+            }
+            return inputFiles;
+        }
+
+
+        /*
+          The items of a deck share a small number of Dimension
+          instances; they are shared in the loaded deck as well.
+        */
+        class DimensionTable {
+        public:
+            void read(CacheReader& reader , std::vector<std::shared_ptr<const Dimension> >& dimensions) {
+                dimensions.resize( reader.readLength( sizeof(uint64_t) ));
+                for (auto& dimension : dimensions) {
+                    std::string name = reader.readString();
+                    double SIfactor = reader.readValue<double>();
+                    double SIoffset = reader.readValue<double>();
+                    auto key = std::make_tuple( name , SIfactor , SIoffset );
+                    auto iter = m_dimensions.find( key );
+
+                    if (iter == m_dimensions.end()) {
+                        std::shared_ptr<const Dimension> newDimension( Dimension::newComposite( name , SIfactor , SIoffset ));
+                        iter = m_dimensions.insert( std::make_pair( key , newDimension )).first;
+                    }
+                    dimension = iter->second;
+                }
+            }
+
+        private:
+            std::map<std::tuple<std::string, double, double>, std::shared_ptr<const Dimension> > m_dimensions;
+        };
+
+
+        // 64 bit FNV-1a
+        const uint64_t initialHash = 14695981039346656037ULL;
+
+        void hashBytes(uint64_t& hash , const char* data , size_t size) {
+            for (size_t i = 0; i < size; i++) {
+                hash ^= static_cast<unsigned char>( data[i] );
+                hash *= 1099511628211ULL;
+            }
+        }
+
+        // The terminating '\0' separates the strings.
+        void hashString(uint64_t& hash , const std::string& value) {
+            hashBytes( hash , value.c_str() , value.size() + 1 );
+        }
+
+        uint64_t hashFileContent(const boost::filesystem::path& inputFile) {
+            uint64_t hash = initialHash;
+            std::ifstream stream( inputFile.string().c_str() , std::ios::binary );
+            std::vector<char> buffer( 1 << 16 );
+
+            while (stream) {
+                stream.read( buffer.data() , buffer.size() );
+                hashBytes( hash , buffer.data() , static_cast<size_t>( stream.gcount() ));
+            }
+            return hash;
+        }
+    }
+
+
+
+    DeckCache::DeckCache(std::shared_ptr<const Parser> parser , const boost::filesystem::path& cacheFile) :
+        m_parser( parser ),
+        m_cacheFile( cacheFile ),
+        m_loadedFromCache( false )
+    {
+    }
+
+
+    boost::filesystem::path DeckCache::defaultCacheFile(const std::string& dataFile) {
+        return boost::filesystem::path( dataFile + ".deckcache" );
+    }
+
+
+    const boost::filesystem::path& DeckCache::getCacheFile() const {
+        return m_cacheFile;
+    }
+
+
+    bool DeckCache::loadedFromCache() const {
+        return m_loadedFromCache;
+    }
+
+
+    DeckCache::InputFile DeckCache::inspectFile(const boost::filesystem::path& inputFile , bool hashContent) {
+        InputFile fileInfo;
+        fileInfo.path = boost::filesystem::absolute( inputFile ).string();
+        fileInfo.size = boost::filesystem::file_size( inputFile );
+        fileInfo.modificationTime = boost::filesystem::last_write_time( inputFile );
+        fileInfo.contentHash = hashContent ? hashFileContent( inputFile ) : 0;
+        return fileInfo;
+    }
+
+
+    void DeckCache::writeDimensions(std::ostream& stream , const std::vector<std::shared_ptr<const Dimension> >& dimensions) {
+        writeValue<uint64_t>( stream , dimensions.size() );
+        for (const auto& dimension : dimensions) {
+            writeString( stream , dimension->getName() );
+            writeValue<double>( stream , dimension->m_SIfactor );
+            writeValue<double>( stream , dimension->m_SIoffset );
+        }
+    }
+
+
+    /*
+      The settings of the parser and the ParseMode which change the
+      parsed deck: the unit conversion, lazy keywords, the section
+      selection, the known keywords and the error actions.
+    */
+    uint64_t DeckCache::configurationHash(const ParseMode& parseMode) const {
+        uint64_t hash = initialHash;
+        hashString( hash , m_parser->getEagerUnitConversion() ? "eager" : "lazyUnits" );
+        hashString( hash , m_parser->getKeepRawData() ? "keepRawData" : "inPlace" );
+        hashString( hash , m_parser->getLazyKeywords() ? "lazyKeywords" : "eagerKeywords" );
+
+        hashString( hash , "sections" );
+        for (const auto& section : m_parser->getParseSections())
+            hashString( hash , section );
+
+        hashString( hash , "keywords" );
+        for (const auto& keyword : m_parser->getParseKeywords())
+            hashString( hash , keyword );
+
+        hashString( hash , "deckNames" );
+        std::vector<std::string> deckNames = m_parser->getAllDeckNames();
+        std::sort( deckNames.begin() , deckNames.end() );
+        for (const auto& deckName : deckNames)
+            hashString( hash , deckName );
+
+        hashString( hash , "parseMode" );
+        for (const auto& pair : parseMode) {
+            hashString( hash , pair.first );
+            hashString( hash , std::to_string( static_cast<int>( pair.second )));
+        }
+        return hash;
+    }
+
+
+    /*
+      The size and modification time are checked first; the content is
+      only hashed for files where the modification time has changed.
+      The modification time has a resolution of one second, so a file
+      modified in the same second as the cache was written can have
+      changed without a new modification time; such files are always
+      hashed.
+    */
+    bool DeckCache::isValid(const std::string& dataFile , const ParseMode& parseMode) const {
+        std::ifstream stream( m_cacheFile.string().c_str() , std::ios::binary );
+        if (!stream.is_open())
+            return false;
+
+        std::vector<InputFile> inputFiles;
+        int64_t cacheTime;
+        uint64_t cacheConfiguration;
+        try {
+            CacheReader reader( stream );
+            inputFiles = readInputFiles( reader , m_cacheFile.string() , cacheTime , cacheConfiguration );
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+
+        if (cacheConfiguration != configurationHash( parseMode ))
+            return false;
+
+        if (inputFiles.empty() || inputFiles[0].path != boost::filesystem::absolute( dataFile ).string())
+            return false;
+
+        for (const auto& fileInfo : inputFiles) {
+            boost::system::error_code ec;
+            if (!boost::filesystem::is_regular_file( fileInfo.path , ec ))
+                return false;
+
+            InputFile current = inspectFile( fileInfo.path , false );
+            if (current.size != fileInfo.size)
+                return false;
+
+            bool trustModificationTime = (current.modificationTime == fileInfo.modificationTime) && (fileInfo.modificationTime < cacheTime);
+            if (!trustModificationTime && hashFileContent( fileInfo.path ) != fileInfo.contentHash)
+                return false;
+        }
+        return true;
+    }
+
+
+    DeckPtr DeckCache::parseFile(const std::string& dataFile , const ParseMode& parseMode) {
+        // with section selective parsing the deck is not complete, and
+        // with in place SI conversion the raw values are gone; the
+        // cache is neither used nor written.
+        if (m_parser->hasParseSelection() || (m_parser->getEagerUnitConversion() && !m_parser->getKeepRawData())) {
+            m_loadedFromCache = false;
+            return m_parser->parseFile( dataFile , parseMode );
+        }
+
+        // a cache which can not be read is treated as a cache miss.
+        if (isValid( dataFile , parseMode )) {
+            std::ifstream stream( m_cacheFile.string().c_str() , std::ios::binary );
+            try {
+                DeckPtr deck = readDeck( stream );
+                m_loadedFromCache = true;
+                return deck;
+            } catch (const std::runtime_error&) {
+            }
+        }
+
+        m_loadedFromCache = false;
+        DeckPtr deck = m_parser->parseFile( dataFile , parseMode );
+        try {
+            writeCache( *deck , parseMode );
+        } catch (const std::exception& e) {
+            OpmLog::addMessage(Log::MessageType::Warning , "The deck cache " + m_cacheFile.string() + " was not written: " + e.what());
+        }
+        return deck;
+    }
+
+
+    /*
+      The cache is written to a temporary file which is renamed into
+      place; a reader will never see a partially written cache. The
+      temporary file is removed if the writing fails.
+    */
+    void DeckCache::writeCache(const Deck& deck , const ParseMode& parseMode) const {
+        boost::filesystem::path tmpFile = m_cacheFile;
+        tmpFile += ".tmp";
+        try {
+            {
+                std::ofstream stream( tmpFile.string().c_str() , std::ios::binary );
+                if (!stream.is_open())
+                    throw std::runtime_error("Could not open deck cache: " + tmpFile.string() + " for writing");
+
+                writeDeck( deck , parseMode , stream );
+                if (!stream)
+                    throw std::runtime_error("Writing deck cache: " + tmpFile.string() + " failed");
+            }
+            boost::filesystem::rename( tmpFile , m_cacheFile );
+        } catch (...) {
+            boost::system::error_code ec;
+            boost::filesystem::remove( tmpFile , ec );
+            throw;
+        }
+    }
+
+
+    void DeckCache::writeDeck(const Deck& deck , const ParseMode& parseMode , std::ostream& stream) const {
+        stream.write( cacheMagic , sizeof cacheMagic );
+        writeValue<uint32_t>( stream , cacheVersion );
+        writeValue<int64_t>( stream , std::time( nullptr ));
+        writeValue<uint64_t>( stream , configurationHash( parseMode ));
+
+        const auto& inputFiles = deck.getInputFiles();
+        writeValue<uint64_t>( stream , inputFiles.size() );
+        for (const auto& inputFile : inputFiles) {
+            InputFile fileInfo = inspectFile( inputFile );
+            writeString( stream , fileInfo.path );
+            writeValue<uint64_t>( stream , fileInfo.size );
+            writeValue<int64_t>( stream , fileInfo.modificationTime );
+            writeValue<uint64_t>( stream , fileInfo.contentHash );
+        }
+
+        writeValue<uint64_t>( stream , deck.size() );
+        for (const auto& keyword : deck) {
+            writeString( stream , keyword->name() );
+            writeString( stream , keyword->getFileName() );
+            writeValue<int32_t>( stream , keyword->getLineNumber() );
+            writeValue<uint8_t>( stream , keyword->isKnown() );
+            writeValue<uint8_t>( stream , keyword->isDataKeyword() );
+
+            writeValue<uint64_t>( stream , keyword->size() );
+            for (const auto& record : *keyword) {
+                writeValue<uint64_t>( stream , record->size() );
+                for (size_t itemIndex = 0; itemIndex < record->size(); itemIndex++) {
+                    DeckItemConstPtr item = record->getItem( itemIndex );
+
+                    if (auto intItem = std::dynamic_pointer_cast<const DeckIntItem>( item )) {
+                        writeValue<uint8_t>( stream , INT_ITEM );
+                        writeString( stream , item->name() );
+                        writeValue<uint8_t>( stream , item->m_scalar );
+                        writeFlags( stream , item->m_dataPointDefaulted );
+                        writeVector( stream , intItem->m_data );
+                    } else if (auto floatItem = std::dynamic_pointer_cast<const DeckFloatItem>( item )) {
+                        writeValue<uint8_t>( stream , FLOAT_ITEM );
+                        writeString( stream , item->name() );
+                        writeValue<uint8_t>( stream , item->m_scalar );
+                        writeFlags( stream , item->m_dataPointDefaulted );
+                        writeVector( stream , floatItem->m_data );
+                        writeDimensions( stream , floatItem->m_dimensions );
+                    } else if (auto doubleItem = std::dynamic_pointer_cast<const DeckDoubleItem>( item )) {
+                        if (!doubleItem->hasRawData())
+                            throw std::invalid_argument("The item " + item->name() + " has been converted to SI in place - can not cache the deck");
+
+                        writeValue<uint8_t>( stream , DOUBLE_ITEM );
+                        writeString( stream , item->name() );
+                        writeValue<uint8_t>( stream , item->m_scalar );
+                        writeFlags( stream , item->m_dataPointDefaulted );
+                        writeVector( stream , doubleItem->m_data );
+                        writeDimensions( stream , doubleItem->m_dimensions );
+                    } else if (auto stringItem = std::dynamic_pointer_cast<const DeckStringItem>( item )) {
+                        writeValue<uint8_t>( stream , STRING_ITEM );
+                        writeString( stream , item->name() );
+                        writeValue<uint8_t>( stream , item->m_scalar );
+                        writeFlags( stream , item->m_dataPointDefaulted );
+                        writeStrings( stream , stringItem->m_data );
+                    } else
+                        throw std::invalid_argument("Can not serialize the item " + item->name() + " in keyword " + keyword->name());
+                }
+            }
+        }
+    }
+
+
+    DeckPtr DeckCache::readDeck(std::istream& stream) const {
+        DeckPtr deck = std::make_shared<Deck>();
+        DimensionTable dimensionTable;
+        CacheReader reader( stream );
+
+        int64_t cacheTime;
+        uint64_t cacheConfiguration;
+        for (const auto& fileInfo : readInputFiles( reader , m_cacheFile.string() , cacheTime , cacheConfiguration ))
+            deck->addInputFile( fileInfo.path );
+
+        size_t numKeywords = reader.readLength( sizeof(uint64_t) );
+        for (size_t keywordIndex = 0; keywordIndex < numKeywords; keywordIndex++) {
+            std::string name = reader.readString();
+            std::string fileName = reader.readString();
+            int lineNumber = reader.readValue<int32_t>();
+            bool isKnown = reader.readValue<uint8_t>();
+            bool isDataKeyword = reader.readValue<uint8_t>();
+
+            DeckKeywordPtr keyword = std::make_shared<DeckKeyword>( name , isKnown );
+            keyword->setLocation( fileName , lineNumber );
+            keyword->setDataKeyword( isDataKeyword );
+            if (isKnown && m_parser->isRecognizedKeyword( name )) {
+                ParserKeywordConstPtr parserKeyword = m_parser->getParserKeywordFromDeckName( name );
+                keyword->setParserKeyword( parserKeyword );
+            }
+
+            size_t numRecords = reader.readLength( sizeof(uint64_t) );
+            for (size_t recordIndex = 0; recordIndex < numRecords; recordIndex++) {
+                DeckRecordPtr record = std::make_shared<DeckRecord>();
+                size_t numItems = reader.readLength( sizeof(uint64_t) );
+
+                for (size_t itemIndex = 0; itemIndex < numItems; itemIndex++) {
+                    uint8_t itemType = reader.readValue<uint8_t>();
+                    std::string itemName = reader.readString();
+                    bool scalar = reader.readValue<uint8_t>();
+                    DeckItemPtr item;
+
+                    switch (itemType) {
+                    case INT_ITEM:
+                        {
+                            auto intItem = std::make_shared<DeckIntItem>( itemName , scalar );
+                            reader.readFlags( intItem->m_dataPointDefaulted );
+                            reader.readVector( intItem->m_data );
+                            item = intItem;
+                            break;
+                        }
+                    case FLOAT_ITEM:
+                        {
+                            auto floatItem = std::make_shared<DeckFloatItem>( itemName , scalar );
+                            reader.readFlags( floatItem->m_dataPointDefaulted );
+                            reader.readVector( floatItem->m_data );
+                            dimensionTable.read( reader , floatItem->m_dimensions );
+                            item = floatItem;
+                            break;
+                        }
+                    case DOUBLE_ITEM:
+                        {
+                            auto doubleItem = std::make_shared<DeckDoubleItem>( itemName , scalar );
+                            reader.readFlags( doubleItem->m_dataPointDefaulted );
+                            reader.readVector( doubleItem->m_data );
+                            dimensionTable.read( reader , doubleItem->m_dimensions );
+                            item = doubleItem;
+                            break;
+                        }
+                    case STRING_ITEM:
+                        {
+                            auto stringItem = std::make_shared<DeckStringItem>( itemName , scalar );
+                            reader.readFlags( stringItem->m_dataPointDefaulted );
+                            reader.readStrings( stringItem->m_data );
+                            item = stringItem;
+                            break;
+                        }
+                    default:
+                        throw std::runtime_error("Deck cache is truncated or corrupt");
+                    }
+                    record->addItem( item );
+                }
+                keyword->addRecord( record );
+            }
+            deck->addKeyword( keyword );
+        }
+
+        deck->initUnitSystem();
+        return deck;
+    }
+}
@@ -0,0 +1,94 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DECK_CACHE_HPP
+#define DECK_CACHE_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+
+namespace Opm {
+
+    class Dimension;
+    class Parser;
+    class ParseMode;
+
+    /// Binary cache of a parsed Deck. The cache file starts with the
+    /// size, modification time and content hash of the root file and
+    /// all INCLUDE files, followed by the keywords, records and items
+    /// of the deck - including the defaulted flags, the dimensions and
+    /// the file/line location of the keywords.
+    ///
+    /// The cache is valid as long as none of the input files have
+    /// changed; a file with a new modification time but unchanged
+    /// content does not invalidate the cache. The ParseMode and the
+    /// parser settings which change the deck are hashed into the cache
+    /// as well, so a deck is only loaded with the configuration it was
+    /// parsed with. A cache which can not be read is a cache miss.
+
+    class DeckCache {
+    public:
+        struct InputFile {
+            std::string path;
+            uint64_t size;
+            int64_t modificationTime;
+            uint64_t contentHash;
+        };
+
+        DeckCache(std::shared_ptr<const Parser> parser , const boost::filesystem::path& cacheFile);
+
+        /// Loads the deck from the cache file if it is valid for
+        /// dataFile; otherwise dataFile is parsed and the cache file is
+        /// written. A parser with a section selection, or which
+        /// converts to SI in place, always parses. Failing to write the
+        /// cache is only a warning.
+        DeckPtr parseFile(const std::string& dataFile , const ParseMode& parseMode);
+
+        bool isValid(const std::string& dataFile , const ParseMode& parseMode) const;
+        bool loadedFromCache() const;
+        const boost::filesystem::path& getCacheFile() const;
+        uint64_t configurationHash(const ParseMode& parseMode) const;
+
+        void writeDeck(const Deck& deck , const ParseMode& parseMode , std::ostream& stream) const;
+        /// Throws std::runtime_error if the stream is truncated or corrupt.
+        DeckPtr readDeck(std::istream& stream) const;
+
+        static boost::filesystem::path defaultCacheFile(const std::string& dataFile);
+        static InputFile inspectFile(const boost::filesystem::path& inputFile , bool hashContent = true);
+
+    private:
+        void writeCache(const Deck& deck , const ParseMode& parseMode) const;
+        static void writeDimensions(std::ostream& stream , const std::vector<std::shared_ptr<const Dimension> >& dimensions);
+
+        std::shared_ptr<const Parser> m_parser;
+        boost::filesystem::path m_cacheFile;
+        bool m_loadedFromCache;
+    };
+
+    typedef std::shared_ptr<DeckCache> DeckCachePtr;
+}
+
+#endif
@@ -0,0 +1,414 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <stdexcept>
+
+#include <opm/parser/eclipse/Parser/KeywordMatcher.hpp>
+
+namespace Opm {
+
+    /*
+      Recursive descent parser for the supported subset of the POSIX
+      extended regular expressions; the NFA is built with the Thompson
+      construction. The end state of every fragment has no outgoing
+      transitions until the fragment is combined with another one.
+    */
+
+    class KeywordMatcher::PatternParser {
+    public:
+        PatternParser(KeywordMatcher& matcher , const std::string& pattern) :
+            m_matcher( matcher ),
+            m_pattern( pattern ),
+            m_pos( 0 )
+        { }
+
+        Fragment parse() {
+            Fragment fragment = parseAlternation();
+            if (m_pos != m_pattern.size())
+                throw std::invalid_argument("Unbalanced ')' in pattern: " + m_pattern);
+            return fragment;
+        }
+
+        Fragment literal(const std::string& name) {
+            Fragment fragment = empty();
+            for (char c : name) {
+                CharSet charSet;
+                charSet.set( static_cast<unsigned char>(c) );
+                fragment = concatenate( fragment , single( charSet ));
+            }
+            return fragment;
+        }
+
+    private:
+        Fragment parseAlternation() {
+            Fragment fragment = parseConcatenation();
+            while (m_pos < m_pattern.size() && m_pattern[m_pos] == '|') {
+                m_pos++;
+                fragment = alternate( fragment , parseConcatenation() );
+            }
+            return fragment;
+        }
+
+        Fragment parseConcatenation() {
+            Fragment fragment = empty();
+            while (m_pos < m_pattern.size() && m_pattern[m_pos] != '|' && m_pattern[m_pos] != ')')
+                fragment = concatenate( fragment , parseRepetition() );
+            return fragment;
+        }
+
+        Fragment parseRepetition() {
+            Fragment fragment = parseAtom();
+            while (m_pos < m_pattern.size()) {
+                char c = m_pattern[m_pos];
+                if (c == '*')
+                    fragment = star( fragment );
+                else if (c == '+')
+                    fragment = plus( fragment );
+                else if (c == '?')
+                    fragment = optional( fragment );
+                else
+                    break;
+                m_pos++;
+            }
+            return fragment;
+        }
+
+        Fragment parseAtom() {
+            char c = m_pattern[m_pos++];
+            CharSet charSet;
+
+            switch (c) {
+            case '(': {
+                Fragment fragment = parseAlternation();
+                if (m_pos == m_pattern.size() || m_pattern[m_pos] != ')')
+                    throw std::invalid_argument("Missing ')' in pattern: " + m_pattern);
+                m_pos++;
+                return fragment;
+            }
+            case '[':
+                return single( parseBracket() );
+            case '.':
+                charSet.set();
+                return single( charSet );
+            case '\\':
+                if (m_pos == m_pattern.size())
+                    throw std::invalid_argument("Trailing '\\' in pattern: " + m_pattern);
+                charSet.set( static_cast<unsigned char>(m_pattern[m_pos++]) );
+                return single( charSet );
+            case '*':
+            case '+':
+            case '?':
+            case '{':
+            case '}':
+            case '^':
+            case '$':
+                throw std::invalid_argument("Unsupported use of '" + std::string(1 , c) + "' in pattern: " + m_pattern);
+            default:
+                charSet.set( static_cast<unsigned char>(c) );
+                return single( charSet );
+            }
+        }
+
+        CharSet parseBracket() {
+            CharSet charSet;
+            bool negate = false;
+            bool first = true;
+
+            if (m_pos < m_pattern.size() && m_pattern[m_pos] == '^') {
+                negate = true;
+                m_pos++;
+            }
+
+            while (true) {
+                if (m_pos == m_pattern.size())
+                    throw std::invalid_argument("Missing ']' in pattern: " + m_pattern);
+
+                unsigned char c = m_pattern[m_pos++];
+                if (c == ']' && !first)
+                    break;
+                if (c == '[' && m_pos < m_pattern.size() && (m_pattern[m_pos] == ':' || m_pattern[m_pos] == '=' || m_pattern[m_pos] == '.'))
+                    throw std::invalid_argument("Character classes are not supported in pattern: " + m_pattern);
+
+                first = false;
+                if (m_pos + 1 < m_pattern.size() && m_pattern[m_pos] == '-' && m_pattern[m_pos + 1] != ']') {
+                    unsigned char last = m_pattern[m_pos + 1];
+                    if (last < c)
+                        throw std::invalid_argument("Invalid range in pattern: " + m_pattern);
+                    for (unsigned int r = c; r <= last; r++)
+                        charSet.set( r );
+                    m_pos += 2;
+                } else
+                    charSet.set( c );
+            }
+
+            if (negate)
+                charSet.flip();
+            return charSet;
+        }
+
+        Fragment empty() {
+            int state = m_matcher.addState();
+            return { state , state };
+        }
+
+        Fragment single(const CharSet& charSet) {
+            int start = m_matcher.addState( m_matcher.addCharSet( charSet ));
+            int end = m_matcher.addState();
+            m_matcher.m_nfa[start].next = end;
+            return { start , end };
+        }
+
+        Fragment concatenate(const Fragment& first , const Fragment& second) {
+            m_matcher.m_nfa[first.end].next = second.start;
+            return { first.start , second.end };
+        }
+
+        Fragment alternate(const Fragment& first , const Fragment& second) {
+            int start = m_matcher.addState();
+            int end = m_matcher.addState();
+            m_matcher.m_nfa[start].next = first.start;
+            m_matcher.m_nfa[start].alt = second.start;
+            m_matcher.m_nfa[first.end].next = end;
+            m_matcher.m_nfa[second.end].next = end;
+            return { start , end };
+        }
+
+        Fragment star(const Fragment& fragment) {
+            int start = m_matcher.addState();
+            int end = m_matcher.addState();
+            m_matcher.m_nfa[start].next = fragment.start;
+            m_matcher.m_nfa[start].alt = end;
+            m_matcher.m_nfa[fragment.end].next = fragment.start;
+            m_matcher.m_nfa[fragment.end].alt = end;
+            return { start , end };
+        }
+
+        Fragment plus(const Fragment& fragment) {
+            int end = m_matcher.addState();
+            m_matcher.m_nfa[fragment.end].next = fragment.start;
+            m_matcher.m_nfa[fragment.end].alt = end;
+            return { fragment.start , end };
+        }
+
+        Fragment optional(const Fragment& fragment) {
+            int start = m_matcher.addState();
+            int end = m_matcher.addState();
+            m_matcher.m_nfa[start].next = fragment.start;
+            m_matcher.m_nfa[start].alt = end;
+            m_matcher.m_nfa[fragment.end].next = end;
+            return { start , end };
+        }
+
+        KeywordMatcher& m_matcher;
+        const std::string& m_pattern;
+        size_t m_pos;
+    };
+
+
+
+    KeywordMatcher::KeywordMatcher() {
+        clear();
+    }
+
+
+    void KeywordMatcher::clear() {
+        m_nfa.clear();
+        m_charSets.clear();
+        m_startStates.clear();
+        m_transitions.clear();
+        m_acceptIds.clear();
+        // an empty matcher is compiled, and matches nothing.
+        compile();
+    }
+
+
+    bool KeywordMatcher::addPattern(const std::string& pattern , int id) {
+        size_t numStates = m_nfa.size();
+        size_t numCharSets = m_charSets.size();
+
+        try {
+            PatternParser parser( *this , pattern );
+            Fragment fragment = parser.parse();
+            m_nfa[fragment.end].acceptId = id;
+            m_startStates.push_back( fragment.start );
+            m_compiled = false;
+            return true;
+        } catch (const std::invalid_argument&) {
+            m_nfa.resize( numStates );
+            m_charSets.resize( numCharSets );
+            return false;
+        }
+    }
+
+
+    void KeywordMatcher::addName(const std::string& name , int id) {
+        std::string pattern;
+        PatternParser parser( *this , pattern );
+        Fragment fragment = parser.literal( name );
+        m_nfa[fragment.end].acceptId = id;
+        m_startStates.push_back( fragment.start );
+        m_compiled = false;
+    }
+
+
+    size_t KeywordMatcher::numPatterns() const {
+        return m_startStates.size();
+    }
+
+
+    size_t KeywordMatcher::numStates() const {
+        return m_acceptIds.size();
+    }
+
+
+    int KeywordMatcher::addState(int charSet) {
+        m_nfa.push_back( { charSet , -1 , -1 , -1 } );
+        return static_cast<int>(m_nfa.size() - 1);
+    }
+
+
+    int KeywordMatcher::addCharSet(const CharSet& charSet) {
+        auto iter = std::find( m_charSets.begin() , m_charSets.end() , charSet );
+        if (iter != m_charSets.end())
+            return static_cast<int>(iter - m_charSets.begin());
+
+        m_charSets.push_back( charSet );
+        return static_cast<int>(m_charSets.size() - 1);
+    }
+
+
+    /*
+      Replaces the states with their epsilon closure. Only the states
+      with a character transition or an accept id are kept, sorted, so
+      the result can be used as the key of the DFA state.
+    */
+    void KeywordMatcher::epsilonClosure(std::vector<int>& states) const {
+        std::vector<char> visited( m_nfa.size() , 0 );
+        std::vector<int> stack( states );
+        states.clear();
+
+        while (!stack.empty()) {
+            int state = stack.back();
+            stack.pop_back();
+            if (state < 0 || visited[state])
+                continue;
+
+            visited[state] = 1;
+            const NFAState& nfaState = m_nfa[state];
+            if (nfaState.charSet >= 0 || nfaState.acceptId >= 0)
+                states.push_back( state );
+
+            if (nfaState.charSet < 0) {
+                stack.push_back( nfaState.next );
+                stack.push_back( nfaState.alt );
+            }
+        }
+        std::sort( states.begin() , states.end() );
+    }
+
+
+    /*
+      Subset construction of the DFA. The bytes are first partitioned in
+      classes of bytes which are in exactly the same character sets, so
+      the transition table has one column per class instead of 256.
+    */
+    void KeywordMatcher::compile() {
+        m_transitions.clear();
+        m_acceptIds.clear();
+
+        std::vector<unsigned char> representative;
+        {
+            std::map<std::vector<bool> , uint8_t> classes;
+            for (unsigned int c = 0; c < 256; c++) {
+                std::vector<bool> signature( m_charSets.size() );
+                for (size_t index = 0; index < m_charSets.size(); index++)
+                    signature[index] = m_charSets[index][c];
+
+                auto iter = classes.find( signature );
+                if (iter == classes.end()) {
+                    iter = classes.insert( std::make_pair( signature , static_cast<uint8_t>(classes.size()) )).first;
+                    representative.push_back( static_cast<unsigned char>(c) );
+                }
+                m_charClass[c] = iter->second;
+            }
+            m_numCharClasses = classes.size();
+        }
+
+        std::map<std::vector<int> , int> dfaStates;
+        std::deque<std::vector<int> > queue;
+        {
+            std::vector<int> start( m_startStates );
+            epsilonClosure( start );
+            dfaStates[start] = 0;
+            queue.push_back( start );
+        }
+
+        for (int dfaState = 0; !queue.empty(); dfaState++) {
+            std::vector<int> states = queue.front();
+            queue.pop_front();
+
+            int acceptId = -1;
+            for (int state : states) {
+                int id = m_nfa[state].acceptId;
+                if (id >= 0 && (acceptId < 0 || id < acceptId))
+                    acceptId = id;
+            }
+            m_acceptIds.push_back( acceptId );
+            m_transitions.resize( m_transitions.size() + m_numCharClasses , -1 );
+
+            for (size_t charClass = 0; charClass < m_numCharClasses; charClass++) {
+                std::vector<int> next;
+                for (int state : states) {
+                    const NFAState& nfaState = m_nfa[state];
+                    if (nfaState.charSet >= 0 && m_charSets[nfaState.charSet][representative[charClass]])
+                        next.push_back( nfaState.next );
+                }
+                if (next.empty())
+                    continue;
+
+                epsilonClosure( next );
+                auto iter = dfaStates.find( next );
+                if (iter == dfaStates.end()) {
+                    iter = dfaStates.insert( std::make_pair( next , static_cast<int>(dfaStates.size()) )).first;
+                    queue.push_back( next );
+                }
+                m_transitions[dfaState * m_numCharClasses + charClass] = iter->second;
+            }
+        }
+
+        m_compiled = true;
+    }
+
+
+    int KeywordMatcher::match(const std::string& name) const {
+        if (!m_compiled)
+            throw std::logic_error("KeywordMatcher::compile() must be called before match()");
+
+        int state = 0;
+        for (char c : name) {
+            state = m_transitions[state * m_numCharClasses + m_charClass[static_cast<unsigned char>(c)]];
+            if (state < 0)
+                return -1;
+        }
+        return m_acceptIds[state];
+    }
+}
@@ -0,0 +1,94 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef KEYWORD_MATCHER_HPP
+#define KEYWORD_MATCHER_HPP
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+    /// Matches a deck name against a set of patterns in one pass. All
+    /// the patterns are combined in one NFA, which is converted to a DFA
+    /// by compile(); match() is then one table lookup per character.
+    ///
+    /// The patterns are POSIX extended regular expressions which must
+    /// match the complete name, limited to literals, '.', bracket
+    /// expressions, grouping, '|' and the '*', '+' and '?' operators.
+    /// Every pattern has an id; when several patterns match a name the
+    /// smallest id is returned.
+
+    class KeywordMatcher {
+    public:
+        KeywordMatcher();
+
+        /// Returns false, and leaves the matcher unchanged, if the
+        /// pattern uses syntax which is not supported.
+        bool addPattern(const std::string& pattern , int id);
+        void addName(const std::string& name , int id);
+
+        void compile();
+        void clear();
+
+        /// The smallest id of the patterns matching name, or -1.
+        int match(const std::string& name) const;
+
+        size_t numPatterns() const;
+        size_t numStates() const;
+
+    private:
+        typedef std::bitset<256> CharSet;
+
+        struct NFAState {
+            // a state either has a character transition to 'next', or
+            // epsilon transitions to 'next' and 'alt'.
+            int charSet;
+            int next;
+            int alt;
+            int acceptId;
+        };
+
+        struct Fragment {
+            int start;
+            int end;
+        };
+
+        class PatternParser;
+
+        int addState(int charSet = -1);
+        int addCharSet(const CharSet& charSet);
+        void epsilonClosure(std::vector<int>& states) const;
+
+        std::vector<NFAState> m_nfa;
+        std::vector<CharSet> m_charSets;
+        std::vector<int> m_startStates;
+
+        std::array<uint8_t , 256> m_charClass;
+        size_t m_numCharClasses;
+        std::vector<int> m_transitions;
+        std::vector<int> m_acceptIds;
+        bool m_compiled;
+    };
+}
+
+#endif
@@ -68,6 +68,8 @@ namespace Opm {
         addKey(UNSUPPORTED_COMPORD_TYPE);
         addKey(UNSUPPORTED_INITIAL_THPRES);
         addKey(INTERNAL_ERROR_UNINITIALIZED_THPRES);
+        addKey(SCHEDULE_MULTFLT_UNKNOWN_FAULT);
+        updateKey(SCHEDULE_MULTFLT_UNKNOWN_FAULT , InputError::WARN);
     }
 
     void ParseMode::initEnv() {
@@ -215,6 +217,8 @@ namespace Opm {
     const std::string ParseMode::UNSUPPORTED_INITIAL_THPRES = "UNSUPPORTED_INITIAL_THPRES";
 
     const std::string ParseMode::INTERNAL_ERROR_UNINITIALIZED_THPRES = "INTERNAL_ERROR_UNINITIALIZED_THPRES";
+
+    const std::string ParseMode::SCHEDULE_MULTFLT_UNKNOWN_FAULT = "SCHEDULE_MULTFLT_UNKNOWN_FAULT";
 }
 
 
@@ -191,6 +191,14 @@ namespace Opm {
         */
         const static std::string INTERNAL_ERROR_UNINITIALIZED_THPRES;
 
+        /*
+          A MULTFLT keyword in the SCHEDULE section for a fault which
+          is not in the FAULTS keyword. The fault is left out of the
+          FaultMultiplierHistory; unlike the other settings the
+          default is to warn.
+        */
+        const static std::string SCHEDULE_MULTFLT_UNKNOWN_FAULT;
+
     private:
         void initDefault();
         void initEnv();
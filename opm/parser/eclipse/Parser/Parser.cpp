@@ -17,9 +17,19 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include <opm/parser/eclipse/OpmLog/OpmLog.hpp>
+#include <opm/parser/eclipse/OpmLog/ProfileLog.hpp>
 
 #include <opm/parser/eclipse/Parser/ParseMode.hpp>
 #include <opm/parser/eclipse/Parser/ParserIntItem.hpp>
@@ -27,11 +37,187 @@
 #include <opm/parser/eclipse/Parser/ParserKeyword.hpp>
 #include <opm/parser/eclipse/RawDeck/RawConsts.hpp>
 #include <opm/parser/eclipse/RawDeck/RawEnums.hpp>
+#include <opm/parser/eclipse/RawDeck/RawInputBuffer.hpp>
 #include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/Section.hpp>
+#include <opm/parser/eclipse/Deck/DeckDoubleItem.hpp>
 #include <opm/parser/eclipse/Deck/DeckIntItem.hpp>
 
 namespace Opm {
 
+    /*
+      Book keeping for the parallel parsing of INCLUDE files. An
+      INCLUDE file is independent, and can be parsed in a worker thread,
+      when it does not contain any of the barrier keywords:
+
+        INCLUDE, END : would change what is parsed after the include.
+
+        Size keywords (TABDIMS, EQLDIMS, ...) : would change how the
+        keywords following the include are parsed.
+
+      Keywords in the include file which have their size given by
+      another keyword look up that keyword in the deck; the worker deck
+      is therefore seeded with the last occurrence of all the size
+      keywords at the time the include is encountered. When the main
+      file has been parsed the worker decks are spliced into the main
+      deck at the position of their INCLUDE keyword - the result is
+      identical to the deck from sequential parsing.
+    */
+
+    class ParallelIncludes {
+    public:
+        ParallelIncludes(size_t numThreads , const std::set<std::string>& sizeKeywords) :
+            m_numThreads( numThreads ),
+            m_sizeKeywords( sizeKeywords ),
+            m_barrierKeywords( sizeKeywords ),
+            m_stop( false )
+        {
+            m_barrierKeywords.insert( RawConsts::include );
+            m_barrierKeywords.insert( RawConsts::end );
+        }
+
+
+        ~ParallelIncludes() {
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+                m_stop = true;
+            }
+            m_condition.notify_all();
+            for (auto& thread : m_threads)
+                thread.join();
+        }
+
+
+        const std::set<std::string>& barrierKeywords() const {
+            return m_barrierKeywords;
+        }
+
+
+        void addBarrierKeyword(const std::string& keyword) {
+            m_barrierKeywords.insert( keyword );
+        }
+
+
+        DeckPtr createIncludeDeck(DeckConstPtr deck) const {
+            DeckPtr includeDeck = std::make_shared<Deck>();
+            for (const auto& sizeKeyword : m_sizeKeywords) {
+                if (deck->hasKeyword( sizeKeyword ))
+                    includeDeck->addKeyword( deck->getKeyword( sizeKeyword ));
+            }
+            return includeDeck;
+        }
+
+
+        /*
+          The task will add the keywords from the include file to a deck
+          created with createIncludeDeck(); deckPosition is the size of
+          the main deck when the INCLUDE keyword was encountered.
+        */
+        void submit(size_t deckPosition , size_t seedSize , std::function<DeckPtr()> task) {
+            std::packaged_task<DeckPtr()> packagedTask( task );
+            PendingInclude pending;
+            pending.position = deckPosition;
+            pending.seedSize = seedSize;
+            pending.deck = packagedTask.get_future();
+            m_pending.push_back( std::move( pending ));
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+                m_queue.push_back( std::move( packagedTask ));
+                if (m_threads.size() < std::min( m_numThreads , m_pending.size() ))
+                    m_threads.push_back( std::thread( &ParallelIncludes::worker , this ));
+            }
+            m_condition.notify_one();
+        }
+
+
+        /*
+          Waits for the include files in document order; if parsing one
+          of them failed the exception is rethrown here.
+        */
+        void wait() {
+            for (auto& pending : m_pending)
+                pending.deck.wait();
+
+            for (auto& pending : m_pending)
+                if (pending.deck.valid())
+                    pending.includeDeck = pending.deck.get();
+        }
+
+
+        DeckPtr splice(DeckPtr deck) {
+            if (m_pending.empty())
+                return deck;
+
+            wait();
+            DeckPtr splicedDeck = std::make_shared<Deck>();
+            for (const auto& inputFile : deck->getInputFiles())
+                splicedDeck->addInputFile( inputFile );
+            for (const auto& pending : m_pending)
+                for (const auto& inputFile : pending.includeDeck->getInputFiles())
+                    splicedDeck->addInputFile( inputFile );
+
+            size_t numKeywords = deck->size();
+            for (const auto& pending : m_pending)
+                numKeywords += pending.includeDeck->size() - pending.seedSize;
+            splicedDeck->reserve( numKeywords );
+
+            auto pending = m_pending.begin();
+            for (size_t index = 0; index <= deck->size(); index++) {
+                while (pending != m_pending.end() && pending->position == index) {
+                    DeckConstPtr includeDeck = pending->includeDeck;
+                    for (size_t includeIndex = pending->seedSize; includeIndex < includeDeck->size(); includeIndex++)
+                        splicedDeck->addKeyword( includeDeck->getKeyword( includeIndex ));
+                    ++pending;
+                }
+
+                if (index < deck->size())
+                    splicedDeck->addKeyword( deck->getKeyword( index ));
+            }
+            m_pending.clear();
+            return splicedDeck;
+        }
+
+
+    private:
+        struct PendingInclude {
+            size_t position;
+            size_t seedSize;
+            std::future<DeckPtr> deck;
+            DeckPtr includeDeck;
+        };
+
+
+        void worker() {
+            while (true) {
+                std::packaged_task<DeckPtr()> task;
+                {
+                    std::unique_lock<std::mutex> lock( m_mutex );
+                    m_condition.wait( lock , [this]() { return m_stop || !m_queue.empty(); });
+                    if (m_queue.empty())
+                        return;
+
+                    task = std::move( m_queue.front() );
+                    m_queue.pop_front();
+                }
+                task();
+            }
+        }
+
+
+        size_t m_numThreads;
+        std::set<std::string> m_sizeKeywords;
+        std::set<std::string> m_barrierKeywords;
+        std::vector<PendingInclude> m_pending;
+
+        std::vector<std::thread> m_threads;
+        std::deque<std::packaged_task<DeckPtr()> > m_queue;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stop;
+    };
+
+
+
     struct ParserState {
         const ParseMode& parseMode;
         DeckPtr deck;
@@ -40,8 +226,24 @@ namespace Opm {
         std::map<std::string, std::string> pathMap;
         size_t lineNR;
         std::shared_ptr<std::istream> inputstream;
+        RawInputBufferPtr inputBuffer;
+        std::string lineBuffer;
         RawKeywordPtr rawKeyword;
         std::string nextKeyword;
+        std::shared_ptr<ParallelIncludes> parallelIncludes;
+        // only set when streaming, see Parser::streamFile()
+        Parser::KeywordCallback keywordCallback;
+        std::shared_ptr<const std::set<std::string> > retainedKeywords;
+        // the current section, for section selective parsing
+        std::string section;
+        // only set with Parser::setLazyKeywords()
+        std::shared_ptr<LazyParseContext> lazyContext;
+        // only set when a ProfileLog is active; the bytes, records and
+        // values are counted for the current file.
+        ProfileLogPtr profileLog;
+        size_t bytesRead;
+        size_t recordsProduced;
+        size_t valuesProduced;
 
 
         ParserState(const ParserState& parent)
@@ -50,12 +252,26 @@ namespace Opm {
             deck = parent.deck;
             pathMap = parent.pathMap;
             rootPath = parent.rootPath;
+            parallelIncludes = parent.parallelIncludes;
+            keywordCallback = parent.keywordCallback;
+            retainedKeywords = parent.retainedKeywords;
+            section = parent.section;
+            lazyContext = parent.lazyContext;
+            profileLog = parent.profileLog;
+            bytesRead = 0;
+            recordsProduced = 0;
+            valuesProduced = 0;
+            lineNR = 0;
         }
 
         ParserState(const ParseMode& __parseMode)
             : parseMode( __parseMode )
         {
             deck = std::make_shared<Deck>();
+            profileLog = ProfileLog::getActive();
+            bytesRead = 0;
+            recordsProduced = 0;
+            valuesProduced = 0;
             lineNR = 0;
         }
 
@@ -68,7 +284,7 @@ namespace Opm {
 
         void openString(const std::string& input) {
             dataFile = "";
-            inputstream.reset(new std::istringstream(input));
+            inputBuffer = std::make_shared<RawInputBuffer>( input );
         }
 
 
@@ -78,19 +294,40 @@ namespace Opm {
         }
 
 
+        /*
+          Files are memory mapped and the lines are handed out as views
+          into the mapping; the RawInputBuffer constructor throws if the
+          file does not exist or is not readable.
+        */
         void openFile(const boost::filesystem::path& inputFile) {
-            std::ifstream *ifs = new std::ifstream(inputFile.string().c_str());
-
-            // make sure the file we'd like to parse exists and is
-            // readable
-            if (!ifs->is_open()) {
-                throw std::runtime_error(std::string("Input file '") +
-                                         inputFile.string() +
-                                         std::string("' does not exist or is not readable"));
+            inputBuffer = std::make_shared<RawInputBuffer>( inputFile );
+            inputBuffer->releaseConsumedPages( bool(keywordCallback) );
+            dataFile = inputFile;
+        }
+
+
+        bool isOpen() const {
+            return inputBuffer || inputstream;
+        }
+
+
+        /*
+          The returned line is only valid until the next call to
+          getLine(); when reading from a stream it points into
+          lineBuffer.
+        */
+        bool getLine(string_view& line) {
+            if (inputBuffer) {
+                if (!inputBuffer->getLine( line ))
+                    return false;
+            } else {
+                if (!std::getline( *inputstream , lineBuffer ))
+                    return false;
+                line = string_view( lineBuffer );
             }
 
-            inputstream.reset( ifs );
-            dataFile = inputFile;
+            bytesRead += line.size() + 1;
+            return true;
         }
 
         void openRootFile( const boost::filesystem::path& inputFile) {
@@ -125,12 +362,82 @@ namespace Opm {
 
     };
 
-    Parser::Parser(bool addDefault) {
+    Parser::Parser(bool addDefault) :
+        m_numIncludeThreads( 0 ),
+        m_eagerUnitConversion( false ),
+        m_keepRawData( true ),
+        m_lazyKeywords( false )
+    {
         if (addDefault)
             addDefaultKeywords();
     }
 
 
+    void Parser::setNumIncludeThreads(size_t numThreads) {
+        m_numIncludeThreads = numThreads;
+    }
+
+
+    size_t Parser::getNumIncludeThreads() const {
+        return m_numIncludeThreads;
+    }
+
+
+    void Parser::setEagerUnitConversion(bool eagerConversion , bool keepRawData) {
+        m_eagerUnitConversion = eagerConversion;
+        m_keepRawData = keepRawData;
+    }
+
+
+    bool Parser::getEagerUnitConversion() const {
+        return m_eagerUnitConversion;
+    }
+
+
+    bool Parser::getKeepRawData() const {
+        return m_keepRawData;
+    }
+
+
+    void Parser::setParseSections(const std::set<std::string>& sections) {
+        for (const auto& section : sections) {
+            if (!Section::isSectionDelimiter( section ))
+                throw std::invalid_argument("Not a section: " + section);
+        }
+        m_parseSections = sections;
+    }
+
+
+    void Parser::setParseKeywords(const std::set<std::string>& keywords) {
+        m_parseKeywords = keywords;
+    }
+
+
+    const std::set<std::string>& Parser::getParseSections() const {
+        return m_parseSections;
+    }
+
+
+    const std::set<std::string>& Parser::getParseKeywords() const {
+        return m_parseKeywords;
+    }
+
+
+    bool Parser::hasParseSelection() const {
+        return !m_parseSections.empty() || !m_parseKeywords.empty();
+    }
+
+
+    void Parser::setLazyKeywords(bool lazyKeywords) {
+        m_lazyKeywords = lazyKeywords;
+    }
+
+
+    bool Parser::getLazyKeywords() const {
+        return m_lazyKeywords;
+    }
+
+
     /**
        This function will remove return a copy of the input string
        where all characters following '--' are removed. The function
@@ -142,33 +449,36 @@ namespace Opm {
 
     */
     std::string Parser::stripComments(const std::string& inputString) {
-        std::string uncommentedString;
+        return uncommentedView( inputString ).string();
+    }
+
+
+    /*
+      Same as stripComments(), but the result is a view into the input
+      and no characters are copied.
+    */
+    string_view Parser::uncommentedView(const string_view& inputString) {
         size_t offset = 0;
 
         while (true) {
             size_t commentPos = inputString.find("--" , offset);
             if (commentPos == std::string::npos) {
-                uncommentedString = inputString;
-                break;
+                return inputString;
             } else {
                 size_t quoteStart = inputString.find_first_of("'\"" , offset);
                 if (quoteStart == std::string::npos || quoteStart > commentPos) {
-                    uncommentedString = inputString.substr(0 , commentPos );
-                    break;
+                    return inputString.substr(0 , commentPos );
                 } else {
                     char quoteChar = inputString[quoteStart];
                     size_t quoteEnd = inputString.find( quoteChar , quoteStart + 1);
                     if (quoteEnd == std::string::npos) {
                         // Quotes are not balanced - probably an error?!
-                        uncommentedString = inputString;
-                        break;
+                        return inputString;
                     } else
                         offset = quoteEnd + 1;
                 }
             }
         }
-
-        return uncommentedString;
     }
 
 
@@ -184,8 +494,8 @@ namespace Opm {
         std::shared_ptr<ParserState> parserState = std::make_shared<ParserState>(parseMode);
         parserState->openRootFile( dataFileName );
 
-        parseState(parserState);
-        applyUnitsToDeck(parserState->deck);
+        parseRootState(parserState);
+        finishDeck(parserState);
 
         return parserState->deck;
     }
@@ -194,8 +504,8 @@ namespace Opm {
         std::shared_ptr<ParserState> parserState = std::make_shared<ParserState>(parseMode);
         parserState->openString( data );
 
-        parseState(parserState);
-        applyUnitsToDeck(parserState->deck);
+        parseRootState(parserState);
+        finishDeck(parserState);
 
         return parserState->deck;
     }
@@ -204,12 +514,236 @@ namespace Opm {
         std::shared_ptr<ParserState> parserState = std::make_shared<ParserState>(parseMode);
         parserState->openStream( inputStream );
 
-        parseState(parserState);
-        applyUnitsToDeck(parserState->deck);
+        parseRootState(parserState);
+        finishDeck(parserState);
 
         return parserState->deck;
     }
 
+    void Parser::streamFile(const std::string &dataFileName, const ParseMode& parseMode, KeywordCallback callback) const {
+        std::shared_ptr<ParserState> parserState = std::make_shared<ParserState>(parseMode);
+        initStreamState(parserState , callback);
+        parserState->openRootFile( dataFileName );
+
+        parseState(parserState);
+    }
+
+    void Parser::streamString(const std::string &data, const ParseMode& parseMode, KeywordCallback callback) const {
+        std::shared_ptr<ParserState> parserState = std::make_shared<ParserState>(parseMode);
+        initStreamState(parserState , callback);
+        parserState->openString( data );
+
+        parseState(parserState);
+    }
+
+    void Parser::streamStream(std::shared_ptr<std::istream> inputStream, const ParseMode& parseMode, KeywordCallback callback) const {
+        std::shared_ptr<ParserState> parserState = std::make_shared<ParserState>(parseMode);
+        initStreamState(parserState , callback);
+        parserState->openStream( inputStream );
+
+        parseState(parserState);
+    }
+
+
+    void Parser::initStreamState(std::shared_ptr<ParserState> parserState , KeywordCallback callback) const {
+        parserState->keywordCallback = callback;
+        parserState->retainedKeywords = retainedKeywords();
+        parserState->deck->initUnitSystem();
+    }
+
+
+    /*
+      The keywords which are needed to parse the rest of the input, and
+      can therefore not be dropped when streaming or skipped by section
+      selective parsing.
+    */
+    std::shared_ptr<const std::set<std::string> > Parser::retainedKeywords() const {
+        std::set<std::string> keywords = sizeDefiningKeywords();
+        keywords.insert( "FIELD" );
+        return std::make_shared<const std::set<std::string> >( keywords );
+    }
+
+
+    /*
+      Section selective parsing: the raw keyword is marked as skipped
+      when it is neither in one of the selected sections nor one of the
+      selected keywords. This is decided when the keyword starts, so the
+      records of a skipped keyword are never stored.
+    */
+    void Parser::selectRawKeyword(std::shared_ptr<ParserState> parserState) const {
+        RawKeywordPtr rawKeyword = parserState->rawKeyword;
+        if (!rawKeyword || !hasParseSelection())
+            return;
+
+        const std::string& name = rawKeyword->getKeywordName();
+        if (Section::isSectionDelimiter( name )) {
+            parserState->section = name;
+            return;
+        }
+
+        if (parserState->section.empty() || m_parseSections.count( parserState->section ) || m_parseKeywords.count( name ))
+            return;
+
+        if (name == RawConsts::include || name == RawConsts::paths || name == RawConsts::end || name == RawConsts::endinclude)
+            return;
+
+        if (parserState->retainedKeywords->count( name ))
+            return;
+
+        rawKeyword->skipRecords();
+    }
+
+
+    /*
+      Normally the keyword is just added to the deck. When streaming the
+      units are applied right away and the keyword is passed on to the
+      callback; the keywords needed later in the parsing are retained
+      in the deck. Returns false if the callback stops the parsing.
+    */
+    bool Parser::addDeckKeyword(std::shared_ptr<ParserState> parserState , DeckKeywordPtr deckKeyword) const {
+        DeckPtr deck = parserState->deck;
+        if (!parserState->keywordCallback) {
+            deck->addKeyword(deckKeyword);
+            return true;
+        }
+
+        if (parserState->retainedKeywords->count( deckKeyword->name() )) {
+            deck->addKeyword(deckKeyword);
+            if (deckKeyword->name() == "FIELD")
+                deck->initUnitSystem();
+        }
+        applyUnitsToKeyword(deck , deckKeyword);
+        return parserState->keywordCallback(deckKeyword);
+    }
+
+
+    /*
+      With lazy keywords the raw keyword is kept in the DeckKeyword and
+      parsed when the records are first accessed; the keywords which are
+      needed while parsing, and the keywords without records, are parsed
+      right away.
+    */
+    DeckKeywordPtr Parser::createDeckKeyword(std::shared_ptr<ParserState> parserState , ParserKeywordConstPtr parserKeyword) const {
+        RawKeywordPtr rawKeyword = parserState->rawKeyword;
+        if (parserState->lazyContext && rawKeyword->isFinished() && rawKeyword->size() > 0
+            && !parserState->retainedKeywords->count( rawKeyword->getKeywordName() ))
+            return std::make_shared<DeckKeyword>( parserKeyword , rawKeyword , parserState->lazyContext );
+
+        DeckKeywordPtr deckKeyword = parserKeyword->parse(parserState->parseMode , rawKeyword);
+        deckKeyword->setParserKeyword(parserKeyword);
+        return deckKeyword;
+    }
+
+
+    /*
+      The units are applied when the whole deck is parsed, and the unit
+      system is known; the lazily parsed keywords apply the units of
+      the LazyParseContext when they are parsed.
+    */
+    void Parser::finishDeck(std::shared_ptr<ParserState> parserState) const {
+        DeckPtr deck = parserState->deck;
+        applyUnitsToDeck(deck);
+
+        if (parserState->lazyContext) {
+            std::lock_guard<std::mutex> lock( parserState->lazyContext->unitMutex );
+            parserState->lazyContext->activeUnits = deck->getActiveUnitSystem();
+            parserState->lazyContext->defaultUnits = deck->getDefaultUnitSystem();
+        }
+    }
+
+
+    void Parser::parseRootState(std::shared_ptr<ParserState> parserState) const {
+        if (hasParseSelection() || m_lazyKeywords)
+            parserState->retainedKeywords = retainedKeywords();
+
+        if (m_lazyKeywords) {
+            parserState->lazyContext = std::make_shared<LazyParseContext>();
+            parserState->lazyContext->parseMode = std::make_shared<const ParseMode>( parserState->parseMode );
+            parserState->lazyContext->keepRawData = !m_eagerUnitConversion || m_keepRawData;
+        }
+
+        if (m_numIncludeThreads <= 1) {
+            parseState(parserState);
+            return;
+        }
+
+        std::shared_ptr<ParallelIncludes> parallelIncludes = std::make_shared<ParallelIncludes>( m_numIncludeThreads , sizeDefiningKeywords() );
+        // an include file which changes the section changes how the
+        // keywords after it are selected.
+        if (hasParseSelection()) {
+            for (const auto& section : Section::sectionNames())
+                parallelIncludes->addBarrierKeyword( section );
+        }
+        parserState->parallelIncludes = parallelIncludes;
+        try {
+            parseState(parserState);
+        } catch (...) {
+            // An error in an include file parsed in the background comes
+            // before the current error in the sequential parse order.
+            parallelIncludes->wait();
+            throw;
+        }
+        parserState->deck = parallelIncludes->splice( parserState->deck );
+        parserState->parallelIncludes.reset();
+    }
+
+
+    std::set<std::string> Parser::sizeDefiningKeywords() const {
+        std::set<std::string> sizeKeywords;
+        for (const auto& pair : m_internalParserKeywords) {
+            ParserKeywordConstPtr parserKeyword = pair.second;
+            if (parserKeyword->getSizeType() == OTHER_KEYWORD_IN_DECK)
+                sizeKeywords.insert( parserKeyword->getSizeDefinitionPair().first );
+        }
+        return sizeKeywords;
+    }
+
+
+    static string_view trimRight(const string_view& line) {
+        const char* end = line.end();
+        while (end != line.begin() && std::isspace(static_cast<unsigned char>(*(end - 1))))
+            --end;
+
+        return string_view( line.begin() , end );
+    }
+
+
+    /*
+      Pre scan of an include file: every line is inspected like the
+      start of a keyword, the test is therefore conservative - a data
+      line which happens to look like one of the barrier keywords will
+      just make the include file be parsed sequentially. Besides the
+      keyword name RawKeyword sees, the first word of the line is
+      checked in full and cut to the keyword length, so indented and
+      too long keyword names count as well.
+    */
+    bool Parser::isIndependentInclude(const boost::filesystem::path& includeFile, const std::set<std::string>& barrierKeywords) {
+        RawInputBuffer inputBuffer( includeFile );
+        string_view line;
+
+        while (inputBuffer.getLine( line )) {
+            line = trimRight( uncommentedView( line ));
+            if (line.empty())
+                continue;
+
+            const std::string lineString = line.string();
+            std::string keywordName;
+            if (RawKeyword::isKeywordPrefix( lineString , keywordName ) && barrierKeywords.count( keywordName ))
+                return false;
+
+            const size_t wordStart = lineString.find_first_not_of( " \t" );
+            if (wordStart == std::string::npos)
+                continue;
+
+            const size_t wordEnd = lineString.find_first_of( " \t/" , wordStart );
+            std::string word = boost::to_upper_copy( lineString.substr( wordStart , wordEnd - wordStart ));
+            if (barrierKeywords.count( word ) || barrierKeywords.count( word.substr( 0 , RawConsts::maxKeywordLength )))
+                return false;
+        }
+        return true;
+    }
+
+
     size_t Parser::size() const {
         return m_deckParserKeywords.size();
     }
@@ -222,12 +756,45 @@ namespace Opm {
         return m_internalParserKeywords.at(internalKeywordName);
     }
 
+    /*
+      The wildcard keywords are tried in the order of m_wildCardKeywords,
+      i.e. the first keyword by internal name which matches wins. The
+      name must be a valid deck name.
+    */
     ParserKeywordConstPtr Parser::matchingKeyword(const std::string& name) const {
-        for (auto iter = m_wildCardKeywords.begin(); iter != m_wildCardKeywords.end(); ++iter) {
-            if (iter->second->matches(name))
-                return iter->second;
+        int id = m_wildCardMatcher.match( name );
+        for (int regexId : m_regexWildCards) {
+            if (id >= 0 && regexId > id)
+                break;
+
+            if (m_wildCardMatches[regexId]->matches( name ))
+                return m_wildCardMatches[regexId];
+        }
+
+        if (id >= 0)
+            return m_wildCardMatches[id];
+        else
+            return ParserKeywordConstPtr();
+    }
+
+
+    void Parser::updateWildCardMatcher() {
+        m_wildCardMatcher.clear();
+        m_wildCardMatches.clear();
+        m_regexWildCards.clear();
+
+        for (const auto& pair : m_wildCardKeywords) {
+            ParserKeywordConstPtr parserKeyword = pair.second;
+            int id = static_cast<int>(m_wildCardMatches.size());
+
+            m_wildCardMatches.push_back( parserKeyword );
+            for (auto nameIt = parserKeyword->deckNamesBegin(); nameIt != parserKeyword->deckNamesEnd(); ++nameIt)
+                m_wildCardMatcher.addName( *nameIt , id );
+
+            if (!m_wildCardMatcher.addPattern( parserKeyword->getMatchRegex() , id ))
+                m_regexWildCards.push_back( id );
         }
-        return ParserKeywordConstPtr();
+        m_wildCardMatcher.compile();
     }
 
     bool Parser::hasWildCardKeyword(const std::string& internalKeywordName) const {
@@ -256,8 +823,10 @@ namespace Opm {
             m_deckParserKeywords[*nameIt] = parserKeyword;
         }
 
-        if (parserKeyword->hasMatchRegex())
+        if (parserKeyword->hasMatchRegex()) {
             m_wildCardKeywords[parserKeyword->getName()] = parserKeyword;
+            updateWildCardMatcher();
+        }
     }
 
 
@@ -286,7 +855,8 @@ namespace Opm {
         }
 
         // remove the keyword from the wildcard list
-        m_wildCardKeywords.erase( parserKeywordName );
+        if (m_wildCardKeywords.erase( parserKeywordName ) > 0)
+            updateWildCardMatcher();
 
         return erase;
     }
@@ -297,7 +867,9 @@ namespace Opm {
         if (m_deckParserKeywords.count(deckKeywordName)) {
             return m_deckParserKeywords.at(deckKeywordName);
         } else {
-            ParserKeywordConstPtr wildCardKeyword = matchingKeyword( deckKeywordName );
+            ParserKeywordConstPtr wildCardKeyword;
+            if (ParserKeyword::validDeckName( deckKeywordName ))
+                wildCardKeyword = matchingKeyword( deckKeywordName );
 
             if (wildCardKeyword)
                 return wildCardKeyword;
@@ -341,11 +913,49 @@ namespace Opm {
         return includeFilePath;
     }
 
+    /*
+      Adds the time, the input bytes and the records and values of a
+      keyword to the ProfileLog. The values of a lazily parsed keyword
+      are not counted, that would parse it.
+    */
+    static void profileKeyword(std::shared_ptr<ParserState> parserState , DeckKeywordConstPtr deckKeyword ,
+                               std::chrono::steady_clock::time_point start , size_t startBytes) {
+        if (!parserState->profileLog)
+            return;
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        size_t records = parserState->rawKeyword->size();
+        size_t values = 0;
+        if (deckKeyword->isParsed()) {
+            for (const auto& record : *deckKeyword) {
+                for (size_t index = 0; index < record->size(); index++)
+                    values += record->getItem( index )->size();
+            }
+        }
+
+        parserState->recordsProduced += records;
+        parserState->valuesProduced += values;
+        parserState->profileLog->addSample( "keyword" , deckKeyword->name() , elapsed.count() ,
+                                            parserState->bytesRead - startBytes , records , values );
+    }
+
+
     bool Parser::parseState(std::shared_ptr<ParserState> parserState) const {
         bool stopParsing = false;
+        std::chrono::steady_clock::time_point fileStart;
+        if (parserState->profileLog)
+            fileStart = std::chrono::steady_clock::now();
+
+        if (parserState->isOpen()) {
+            if (!parserState->dataFile.empty())
+                parserState->deck->addInputFile( parserState->dataFile.string() );
 
-        if (parserState->inputstream) {
             while (true) {
+                std::chrono::steady_clock::time_point keywordStart;
+                const size_t keywordBytes = parserState->bytesRead;
+                if (parserState->profileLog)
+                    keywordStart = std::chrono::steady_clock::now();
+
                 bool streamOK = tryParseKeyword(parserState);
                 if (parserState->rawKeyword) {
                     if (parserState->rawKeyword->getKeywordName() == Opm::RawConsts::end) {
@@ -367,25 +977,49 @@ namespace Opm {
                         RawRecordConstPtr firstRecord = parserState->rawKeyword->getRecord(0);
                         std::string includeFileAsString = readValueToken<std::string>(firstRecord->getItem(0));
                         boost::filesystem::path includeFile = getIncludeFilePath(parserState, includeFileAsString);
-                        std::shared_ptr<ParserState> newParserState = parserState->includeState( includeFile );
-
+                        std::shared_ptr<ParallelIncludes> parallelIncludes = parserState->parallelIncludes;
+
+                        if (parallelIncludes && isIndependentInclude( includeFile , parallelIncludes->barrierKeywords() )) {
+                            std::shared_ptr<ParserState> newParserState = parserState->includeState( includeFile );
+                            DeckPtr includeDeck = parallelIncludes->createIncludeDeck( parserState->deck );
+
+                            newParserState->deck = includeDeck;
+                            newParserState->parallelIncludes.reset();
+                            parallelIncludes->submit( parserState->deck->size() , includeDeck->size() ,
+                                                      [this , newParserState]() {
+                                                          parseState( newParserState );
+                                                          return newParserState->deck;
+                                                      });
+                        } else {
+                            std::shared_ptr<ParserState> newParserState = parserState->includeState( includeFile );
 
-                        stopParsing = parseState(newParserState);
-                        if (stopParsing) break;
+                            stopParsing = parseState(newParserState);
+                            parserState->section = newParserState->section;
+                            if (stopParsing) break;
+                        }
+                    } else if (parserState->rawKeyword->isSkipped()) {
+                        // not selected, see Parser::setParseSections()
                     } else {
 
                         if (isRecognizedKeyword(parserState->rawKeyword->getKeywordName())) {
                             ParserKeywordConstPtr parserKeyword = getParserKeywordFromDeckName(parserState->rawKeyword->getKeywordName());
-                            DeckKeywordPtr deckKeyword = parserKeyword->parse(parserState->parseMode , parserState->rawKeyword);
-                            deckKeyword->setParserKeyword(parserKeyword);
-                            parserState->deck->addKeyword(deckKeyword);
+                            DeckKeywordPtr deckKeyword = createDeckKeyword(parserState , parserKeyword);
+                            profileKeyword(parserState , deckKeyword , keywordStart , keywordBytes);
+                            if (!addDeckKeyword(parserState , deckKeyword)) {
+                                stopParsing = true;
+                                break;
+                            }
                         } else {
                             DeckKeywordPtr deckKeyword(new DeckKeyword(parserState->rawKeyword->getKeywordName(), false));
                             const std::string msg = "The keyword " + parserState->rawKeyword->getKeywordName() + " is not recognized";
                             deckKeyword->setLocation(parserState->rawKeyword->getFilename(),
                                                      parserState->rawKeyword->getLineNR());
-                            parserState->deck->addKeyword(deckKeyword);
                             OpmLog::addMessage(Log::MessageType::Warning , Log::fileMessage(parserState->dataFile.string() , parserState->lineNR , msg));
+                            profileKeyword(parserState , deckKeyword , keywordStart , keywordBytes);
+                            if (!addDeckKeyword(parserState , deckKeyword)) {
+                                stopParsing = true;
+                                break;
+                            }
                         }
                     }
                     parserState->rawKeyword.reset();
@@ -395,6 +1029,14 @@ namespace Opm {
             }
         } else
             throw std::invalid_argument("Failed to open file: " + parserState->dataFile.string());
+
+        // the time of a file includes the INCLUDE files parsed sequentially from it
+        if (parserState->profileLog) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - fileStart;
+            const std::string fileName = parserState->dataFile.empty() ? "<input>" : parserState->dataFile.string();
+            parserState->profileLog->addSample( "file" , fileName , elapsed.count() , parserState->bytesRead ,
+                                                parserState->recordsProduced , parserState->valuesProduced );
+        }
         return stopParsing;
     }
 
@@ -471,52 +1113,55 @@ namespace Opm {
 
 
 
-    std::string Parser::doSpecialHandlingForTitleKeyword(std::string line, std::shared_ptr<ParserState> parserState) const {
-        if ((parserState->rawKeyword != NULL) && (parserState->rawKeyword->getKeywordName() == "TITLE"))
-                line = line.append("/");
-        return line;
-    }
-
     bool Parser::tryParseKeyword(std::shared_ptr<ParserState> parserState) const {
-        std::string line;
+        string_view line;
+        std::string titleLine;
 
         if (parserState->nextKeyword.length() > 0) {
             parserState->rawKeyword = createRawKeyword(parserState->nextKeyword, parserState);
             parserState->nextKeyword = "";
+            selectRawKeyword(parserState);
         }
 
         if (parserState->rawKeyword && parserState->rawKeyword->isFinished())
             return true;
 
-        while (std::getline(*parserState->inputstream, line)) {
-            if (line.find("--") != std::string::npos)
-                line = stripComments( line );
+        while (parserState->getLine(line)) {
+            line = trimRight( uncommentedView( line ) ); // Removing garbage (eg. \r)
+
+            // The TITLE keyword is terminated by the end of the line.
+            if (parserState->rawKeyword && parserState->rawKeyword->getKeywordName() == "TITLE") {
+                titleLine = line.string() + RawConsts::slash;
+                line = string_view( titleLine );
+            }
 
-            boost::algorithm::trim_right(line); // Removing garbage (eg. \r)
-            line = doSpecialHandlingForTitleKeyword(line, parserState);
-            std::string keywordString;
             parserState->lineNR++;
 
             // skip empty lines
-            if (line.size() == 0)
+            if (line.empty())
                 continue;
 
             if (parserState->rawKeyword == NULL) {
-                if (RawKeyword::isKeywordPrefix(line, keywordString)) {
+                std::string keywordString;
+                const std::string lineString = line.string();
+                if (RawKeyword::isKeywordPrefix(lineString, keywordString)) {
                     parserState->rawKeyword = createRawKeyword(keywordString, parserState);
+                    selectRawKeyword(parserState);
                 } else
                     /* We are looking at some random gibberish?! */
-                    parserState->handleRandomText( line );
+                    parserState->handleRandomText( lineString );
             } else {
-                if (parserState->rawKeyword->getSizeType() == Raw::UNKNOWN) {
-                    if (isRecognizedKeyword(line)) {
+                // Only lines short enough to be a keyword name need to
+                // be checked; the large data lines are passed straight on.
+                if (parserState->rawKeyword->getSizeType() == Raw::UNKNOWN && line.size() <= RawConsts::maxKeywordLength) {
+                    const std::string lineString = line.string();
+                    if (isRecognizedKeyword(lineString)) {
                         parserState->rawKeyword->finalizeUnknownSize();
-                        parserState->nextKeyword = line;
+                        parserState->nextKeyword = lineString;
                         return true;
                     }
                 }
                 parserState->rawKeyword->addRawRecordString(line);
-                line = "";
             }
 
             if (parserState->rawKeyword
@@ -569,18 +1214,38 @@ namespace Opm {
     }
 
 
-    void Parser::applyUnitsToDeck(DeckPtr deck) const {
-        deck->initUnitSystem();
-        for (size_t index=0; index < deck->size(); ++index) {
-            DeckKeywordConstPtr deckKeyword = deck->getKeyword( index );
-            if (isRecognizedKeyword( deckKeyword->name())) {
-                ParserKeywordConstPtr parserKeyword = getParserKeywordFromDeckName( deckKeyword->name() );
-                if (parserKeyword->hasDimension()) {
-                    parserKeyword->applyUnitsToDeck(deck , deckKeyword);
-                }
+    static void convertKeywordToSI(DeckKeywordConstPtr deckKeyword , bool keepRawData) {
+        for (const auto& deckRecord : *deckKeyword) {
+            for (size_t itemIndex = 0; itemIndex < deckRecord->size(); ++itemIndex) {
+                auto doubleItem = std::dynamic_pointer_cast<DeckDoubleItem>( deckRecord->getItem( itemIndex ));
+                if (doubleItem)
+                    doubleItem->convertToSI( keepRawData );
             }
         }
     }
 
 
+    void Parser::applyUnitsToKeyword(DeckConstPtr deck , DeckKeywordConstPtr deckKeyword) const {
+        // a lazily parsed keyword gets the units when it is parsed
+        if (!deckKeyword->isParsed())
+            return;
+
+        if (isRecognizedKeyword( deckKeyword->name())) {
+            ParserKeywordConstPtr parserKeyword = getParserKeywordFromDeckName( deckKeyword->name() );
+            if (parserKeyword->hasDimension()) {
+                parserKeyword->applyUnitsToDeck(deck , deckKeyword);
+                if (m_eagerUnitConversion)
+                    convertKeywordToSI(deckKeyword , m_keepRawData);
+            }
+        }
+    }
+
+
+    void Parser::applyUnitsToDeck(DeckPtr deck) const {
+        deck->initUnitSystem();
+        for (size_t index=0; index < deck->size(); ++index)
+            applyUnitsToKeyword( deck , deck->getKeyword( index ));
+    }
+
+
 } // namespace Opm
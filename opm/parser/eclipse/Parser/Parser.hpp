@@ -19,8 +19,10 @@
 
 #ifndef OPM_PARSER_HPP
 #define OPM_PARSER_HPP
+#include <functional>
 #include <string>
 #include <map>
+#include <set>
 #include <fstream>
 #include <memory>
 
@@ -31,8 +33,10 @@
 
 #include <opm/parser/eclipse/RawDeck/RawKeyword.hpp>
 #include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Parser/KeywordMatcher.hpp>
 #include <opm/parser/eclipse/Parser/ParseMode.hpp>
 #include <opm/parser/eclipse/Parser/ParserKeyword.hpp>
+#include <opm/parser/eclipse/Utility/Stringview.hpp>
 
 namespace Opm {
 
@@ -48,11 +52,72 @@ namespace Opm {
 
         static std::string stripComments(const std::string& inputString);
 
+        /// Opt-in parallel parsing of INCLUDE files. With numThreads > 1
+        /// the INCLUDE files which neither contain INCLUDE or END nor a
+        /// keyword defining the size of other keywords are parsed
+        /// concurrently on a pool of numThreads threads; the resulting
+        /// Deck is identical to the one from sequential parsing. The
+        /// default, 0, parses everything sequentially.
+        void setNumIncludeThreads(size_t numThreads);
+        size_t getNumIncludeThreads() const;
+
+        /// Opt-in eager unit conversion. With eager conversion all the
+        /// DeckDoubleItems with a dimension are converted to SI when the
+        /// deck is parsed, so getSIDoubleData() is a plain const access.
+        /// With keepRawData == false the values are converted in place,
+        /// halving the memory, and the raw values are no longer available.
+        void setEagerUnitConversion(bool eagerConversion , bool keepRawData = true);
+        bool getEagerUnitConversion() const;
+        bool getKeepRawData() const;
+
+        /// Section selective parsing. Only the keywords in the selected
+        /// sections, e.g. { "RUNSPEC" , "GRID" }, and the selected
+        /// keywords are parsed into the Deck; the other keywords are
+        /// skipped by scanning for their record terminators, without
+        /// tokenizing or converting the data. The section keywords, the
+        /// keywords before the first section, INCLUDE and PATHS, and
+        /// the keywords needed to parse the rest of the input - the size
+        /// keywords and FIELD - are always parsed. Without any selected
+        /// sections or keywords, the default, the whole deck is parsed.
+        void setParseSections(const std::set<std::string>& sections);
+        void setParseKeywords(const std::set<std::string>& keywords);
+        const std::set<std::string>& getParseSections() const;
+        const std::set<std::string>& getParseKeywords() const;
+        bool hasParseSelection() const;
+
+        /// Opt-in lazy keywords. The keywords are kept as raw records
+        /// and only parsed into DeckRecords - with units applied - the
+        /// first time the records are accessed, so the keywords which
+        /// are never used cost neither the conversion nor the memory of
+        /// the DeckItems. Errors in the records of a keyword are then
+        /// reported on first access instead of by parseFile(). The
+        /// double items are converted to SI when the keyword is parsed,
+        /// in place if setEagerUnitConversion() asks for it, so the
+        /// first access is thread safe. The keywords needed to parse
+        /// the rest of the input, and the streaming API, are always
+        /// parsed immediately.
+        void setLazyKeywords(bool lazyKeywords);
+        bool getLazyKeywords() const;
+
         /// The starting point of the parsing process. The supplied file is parsed, and the resulting Deck is returned.
         DeckPtr parseFile(const std::string &dataFile, const ParseMode& parseMode) const;
         DeckPtr parseString(const std::string &data, const ParseMode& parseMode) const;
         DeckPtr parseStream(std::shared_ptr<std::istream> inputStream , const ParseMode& parseMode) const;
 
+        /// Streaming parse: the keywords are handed to the callback one
+        /// at a time, in deck order and with units applied, instead of
+        /// being collected in a Deck. The parsing stops when the callback
+        /// returns false. Only the keywords needed to parse the rest of
+        /// the input - the size keywords (TABDIMS, ...) and FIELD - are
+        /// retained, so the memory does not grow with the deck. The unit
+        /// system is the one in effect when the keyword is read, i.e.
+        /// FIELD must come before the keywords with dimensions as it
+        /// does in RUNSPEC. INCLUDE files are parsed sequentially.
+        typedef std::function<bool(DeckKeywordConstPtr)> KeywordCallback;
+        void streamFile(const std::string &dataFile, const ParseMode& parseMode, KeywordCallback callback) const;
+        void streamString(const std::string &data, const ParseMode& parseMode, KeywordCallback callback) const;
+        void streamStream(std::shared_ptr<std::istream> inputStream , const ParseMode& parseMode, KeywordCallback callback) const;
+
 
         /// Method to add ParserKeyword instances, these holding type and size information about the keywords and their data.
         void addParserKeyword(ParserKeywordConstPtr parserKeyword);
@@ -88,6 +153,14 @@ namespace Opm {
         ParserKeywordConstPtr getParserKeywordFromInternalName(const std::string& internalKeywordName) const;
 
 
+        /*!
+         * \brief Whether an include file can be parsed independently of
+         *        the keywords before it, i.e. whether none of its lines
+         *        can start one of the barrier keywords.
+         */
+        static bool isIndependentInclude(const boost::filesystem::path& includeFile, const std::set<std::string>& barrierKeywords);
+
+
         template <class T>
         void addKeyword() {
             addParserKeyword( std::make_shared<T>());
@@ -102,17 +175,43 @@ namespace Opm {
         // associative map of the parser internal names and the corresponding
         // ParserKeyword object for keywords which match a regular expression
         std::map<std::string, ParserKeywordConstPtr> m_wildCardKeywords;
+        // the deck names and regular expressions of all the wildcard
+        // keywords compiled into one matcher; the matcher id is the
+        // index in m_wildCardMatches. Expressions the matcher does not
+        // support are listed in m_regexWildCards and matched with
+        // ParserKeyword::matches().
+        KeywordMatcher m_wildCardMatcher;
+        std::vector<ParserKeywordConstPtr> m_wildCardMatches;
+        std::vector<int> m_regexWildCards;
 
         bool hasWildCardKeyword(const std::string& keyword) const;
         ParserKeywordConstPtr matchingKeyword(const std::string& keyword) const;
+        void updateWildCardMatcher();
+
+        // number of threads used to parse INCLUDE files; 0 and 1 mean sequential parsing
+        size_t m_numIncludeThreads;
+        bool m_eagerUnitConversion;
+        bool m_keepRawData;
+        std::set<std::string> m_parseSections;
+        std::set<std::string> m_parseKeywords;
+        bool m_lazyKeywords;
 
         bool tryParseKeyword(std::shared_ptr<ParserState> parserState) const;
         bool parseState(std::shared_ptr<ParserState> parserState) const;
+        void parseRootState(std::shared_ptr<ParserState> parserState) const;
+        void initStreamState(std::shared_ptr<ParserState> parserState , KeywordCallback callback) const;
+        bool addDeckKeyword(std::shared_ptr<ParserState> parserState , DeckKeywordPtr deckKeyword) const;
+        DeckKeywordPtr createDeckKeyword(std::shared_ptr<ParserState> parserState , ParserKeywordConstPtr parserKeyword) const;
+        void finishDeck(std::shared_ptr<ParserState> parserState) const;
+        void applyUnitsToKeyword(DeckConstPtr deck , DeckKeywordConstPtr deckKeyword) const;
+        std::set<std::string> sizeDefiningKeywords() const;
+        std::shared_ptr<const std::set<std::string> > retainedKeywords() const;
+        void selectRawKeyword(std::shared_ptr<ParserState> parserState) const;
         RawKeywordPtr createRawKeyword(const std::string& keywordString, std::shared_ptr<ParserState> parserState) const;
         void addDefaultKeywords();
 
         boost::filesystem::path getIncludeFilePath(std::shared_ptr<ParserState> parserState, std::string path) const;
-        std::string doSpecialHandlingForTitleKeyword(std::string line, std::shared_ptr<ParserState> parserState) const;
+        static string_view uncommentedView(const string_view& inputString);
     };
 
 
@@ -103,4 +103,22 @@ namespace Opm {
     void ParserItem::setDescription(std::string description) {
         m_description = description;
     }
+
+
+    size_t countRecordValues(string_view recordString) {
+        size_t numValues = 0;
+        string_view token;
+
+        while (popRecordToken(recordString, token)) {
+            string_view countString;
+            string_view valueString;
+
+            if (isStarToken(token, countString, valueString) && !countString.empty())
+                numValues += readValueToken<int>(countString);
+            else
+                numValues += 1;
+        }
+
+        return numValues;
+    }
 }
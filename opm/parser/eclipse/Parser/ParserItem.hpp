@@ -141,6 +141,57 @@ namespace Opm {
 
 
 
+    /// Splits the next whitespace separated token off the front of
+    /// recordString; returns false when there are no more tokens.
+    inline bool popRecordToken(string_view& recordString , string_view& token) {
+        const char* iter = recordString.begin();
+        const char* end = recordString.end();
+
+        while (iter != end && (*iter == ' ' || *iter == '\t'))
+            ++iter;
+
+        if (iter == end)
+            return false;
+
+        const char* tokenEnd = iter;
+        while (tokenEnd != end && *tokenEnd != ' ' && *tokenEnd != '\t')
+            ++tokenEnd;
+
+        token = string_view( iter , tokenEnd );
+        recordString = string_view( tokenEnd , end );
+        return true;
+    }
+
+
+    /// The number of values in a record string, where "N*" and
+    /// "N*value" count as N values.
+    size_t countRecordValues(string_view recordString);
+
+
+    /// Adds the value(s) of one token to a DeckItem with size type ALL.
+    template<typename ParserItemType , typename DeckItemType , typename ValueType>
+    void ParserItemScanToken(const ParserItemType * self , DeckItemType& deckItem , const string_view& token) {
+        string_view countString;
+        string_view valueString;
+        if (isStarToken(token, countString, valueString)) {
+            StarToken st(token, countString, valueString);
+            ValueType value;
+
+            if (st.hasValue()) {
+                value = readValueToken<ValueType>(st.valueString());
+                deckItem.push_backMultiple( value , st.count());
+            } else {
+                value = self->getDefault();
+                for (size_t i=0; i < st.count(); i++)
+                    deckItem.push_backDefault( value );
+            }
+        } else {
+            ValueType value = readValueToken<ValueType>(token);
+            deckItem.push_back(value);
+        }
+    }
+
+
     /// Scans the rawRecords data according to the ParserItems definition.
     /// returns a DeckItem object.
     /// NOTE: data are popped from the rawRecords deque!
@@ -149,27 +200,18 @@ namespace Opm {
         std::shared_ptr<DeckItemType> deckItem = std::make_shared<DeckItemType>( self->name() , self->scalar() );
 
         if (self->sizeType() == ALL) {
-            while (rawRecord->size() > 0) {
-                std::string token = rawRecord->pop_front();
-
-                std::string countString;
-                std::string valueString;
-                if (isStarToken(token, countString, valueString)) {
-                    StarToken st(token, countString, valueString);
-                    ValueType value;
-
-                    if (st.hasValue()) {
-                        value = readValueToken<ValueType>(st.valueString());
-                        deckItem->push_backMultiple( value , st.count());
-                    } else {
-                        value = self->getDefault();
-                        for (size_t i=0; i < st.count(); i++)
-                            deckItem->push_backDefault( value );
-                    }
-                } else {
-                    ValueType value = readValueToken<ValueType>(token);
-                    deckItem->push_back(value);
-                }
+            string_view recordString;
+            if (rawRecord->takeUnsplitRecord(recordString)) {
+                // The item consumes the complete record, e.g. PERMX or ZCORN; the
+                // values are counted first so the deck item is allocated once, and
+                // then parsed straight from the record string.
+                string_view token;
+                deckItem->reserve( countRecordValues( recordString ));
+                while (popRecordToken(recordString, token))
+                    ParserItemScanToken<ParserItemType, DeckItemType, ValueType>(self, *deckItem, token);
+            } else {
+                while (rawRecord->size() > 0)
+                    ParserItemScanToken<ParserItemType, DeckItemType, ValueType>(self, *deckItem, rawRecord->pop_front());
             }
         } else {
             if (rawRecord->size() == 0) {
@@ -185,9 +227,9 @@ namespace Opm {
             } else {
                 // The '*' should be interpreted as a repetition indicator, but it must
                 // be preceeded by an integer...
-                std::string token = rawRecord->pop_front();
-                std::string countString;
-                std::string valueString;
+                string_view token = rawRecord->pop_front();
+                string_view countString;
+                string_view valueString;
                 if (isStarToken(token, countString, valueString)) {
                     StarToken st(token, countString, valueString);
 
@@ -202,14 +244,10 @@ namespace Opm {
                     // replace the first occurence of "N*FOO" by a sequence of N-1 times
                     // "1*FOO". this is slightly hacky, but it makes it work if the
                     // number of defaults pass item boundaries...
-                    std::string singleRepetition;
                     if (st.hasValue())
-                        singleRepetition = st.valueString();
+                        rawRecord->push_front(st.valueString(), st.count() - 1);
                     else
-                        singleRepetition = "1*";
-
-                    for (size_t i=0; i < st.count() - 1; i++)
-                        rawRecord->push_front(singleRepetition);
+                        rawRecord->push_front(string_view("1*"), st.count() - 1);
                 } else {
                     ValueType value = readValueToken<ValueType>(token);
                     deckItem->push_back(value);
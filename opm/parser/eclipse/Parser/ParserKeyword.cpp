@@ -52,6 +52,7 @@ namespace Opm {
         m_keywordSizeType = sizeType;
         m_Description = "";
         m_fixedSize = 0;
+        m_keywordId = -1;
 
         m_deckNames.insert(m_name);
     }
@@ -242,16 +243,15 @@ namespace Opm {
     }
 
     bool ParserKeyword::validDeckName(const std::string& name) {
-        // make the keyword string ALL_UPPERCASE because Eclipse seems
-        // to be case-insensitive (although this is one of its
-        // undocumented features...)
-        std::string upperCaseName = boost::to_upper_copy(name);
-
-        if (!validNameStart(upperCaseName))
+        // Eclipse seems to be case-insensitive (although this is one of
+        // its undocumented features...); the character classes checked
+        // below are the same for lower and upper case, so the name is
+        // not converted to upper case first.
+        if (!validNameStart(name))
             return false;
 
-        for (size_t i = 1; i < upperCaseName.length(); i++) {
-            char c = upperCaseName[i];
+        for (size_t i = 1; i < name.length(); i++) {
+            char c = name[i];
             if (!isalnum(c) &&
                 c != '-' &&
                 c != '_' &&
@@ -584,6 +584,10 @@ namespace Opm {
         return !m_matchRegexString.empty();
     }
 
+    const std::string& ParserKeyword::getMatchRegex() const {
+        return m_matchRegexString;
+    }
+
     void ParserKeyword::setMatchRegex(const std::string& deckNameRegexp) {
         try {
 #ifdef HAVE_REGEX
@@ -659,6 +663,16 @@ namespace Opm {
     }
 
 
+    int ParserKeyword::getKeywordId() const {
+        return m_keywordId;
+    }
+
+
+    void ParserKeyword::setKeywordId(int keywordId) {
+        m_keywordId = keywordId;
+    }
+
+
     std::string ParserKeyword::createDeclaration(const std::string& indent) const {
         std::stringstream ss;
         ss << indent << "class " << className() << " : public ParserKeyword {" << std::endl;
@@ -667,6 +681,8 @@ namespace Opm {
             std::string local_indent = indent + "    ";
             ss << local_indent << className() << "();" << std::endl;
             ss << local_indent << "static const std::string keywordName;" << std::endl;
+            if (m_keywordId >= 0)
+                ss << local_indent << "static const int keywordId = " << m_keywordId << ";" << std::endl;
             if (m_records.size() > 0 ) {
                 for (auto iter = recordBegin(); iter != recordEnd(); ++iter) {
                     std::shared_ptr<ParserRecord> record = *iter;
@@ -716,6 +732,8 @@ namespace Opm {
             }
         }
         ss << indent << "setDescription(\"" << getDescription() << "\");" << std::endl;
+        if (m_keywordId >= 0)
+            ss << indent << "setKeywordId( keywordId );" << std::endl;
 
         // add the valid sections for the keyword
         ss << indent << "clearValidSectionNames();\n";
@@ -778,6 +796,8 @@ namespace Opm {
         ss << "}" << std::endl;
 
         ss << "const std::string " << className() << "::keywordName = \"" << getName() << "\";" << std::endl;
+        if (m_keywordId >= 0)
+            ss << "const int " << className() << "::keywordId;" << std::endl;
         for (auto iter = recordBegin(); iter != recordEnd(); ++iter) {
             std::shared_ptr<ParserRecord> record = *iter;
             for (size_t i = 0; i < record->size(); i++) {
@@ -791,10 +811,14 @@ namespace Opm {
 
 
     void ParserKeyword::applyUnitsToDeck(std::shared_ptr<const Deck> deck , std::shared_ptr<const DeckKeyword> deckKeyword) const {
+        applyUnits( deck->getActiveUnitSystem() , deck->getDefaultUnitSystem() , deckKeyword );
+    }
+
+    void ParserKeyword::applyUnits(std::shared_ptr<UnitSystem> activeUnits , std::shared_ptr<UnitSystem> defaultUnits , std::shared_ptr<const DeckKeyword> deckKeyword) const {
         for (size_t index = 0; index < deckKeyword->size(); index++) {
             std::shared_ptr<const ParserRecord> parserRecord = getRecord(index);
             std::shared_ptr<const DeckRecord> deckRecord = deckKeyword->getRecord(index);
-            parserRecord->applyUnitsToDeck( deck , deckRecord);
+            parserRecord->applyUnits( activeUnits , defaultUnits , deckRecord);
         }
     }
 }
@@ -72,6 +72,7 @@ namespace Opm {
         static bool validInternalName(const std::string& name);
         static bool validDeckName(const std::string& name);
         bool hasMatchRegex() const;
+        const std::string& getMatchRegex() const;
         void setMatchRegex(const std::string& deckNameRegexp);
         bool matches(const std::string& deckKeywordName) const;
         bool hasDimension() const;
@@ -106,10 +107,17 @@ namespace Opm {
         bool isDataKeyword() const;
         bool equal(const ParserKeyword& other) const;
 
+        // The integer id assigned to the keyword by the keyword
+        // generator, available as ParserKeywords::XXX::keywordId; -1 for
+        // keywords which are not generated.
+        int getKeywordId() const;
+        void setKeywordId(int keywordId);
+
         std::string createDeclaration(const std::string& indent) const;
         std::string createDecl() const;
         std::string createCode() const;
         void applyUnitsToDeck(std::shared_ptr<const Deck> deck , std::shared_ptr<const DeckKeyword> deckKeyword) const;
+        void applyUnits(std::shared_ptr<UnitSystem> activeUnits , std::shared_ptr<UnitSystem> defaultUnits , std::shared_ptr<const DeckKeyword> deckKeyword) const;
     private:
         std::pair<std::string,std::string> m_sizeDefinitionPair;
         std::string m_name;
@@ -126,6 +134,7 @@ namespace Opm {
         size_t m_fixedSize;
         bool m_isTableCollection;
         std::string m_Description;
+        int m_keywordId;
 
         static bool validNameStart(const std::string& name);
         void initDeckNames( const Json::JsonObject& jsonConfig );
@@ -76,14 +76,19 @@ namespace Opm {
 
 
     void ParserRecord::applyUnitsToDeck(std::shared_ptr<const Deck> deck , std::shared_ptr<const DeckRecord> deckRecord) const {
+        applyUnits( deck->getActiveUnitSystem() , deck->getDefaultUnitSystem() , deckRecord );
+    }
+
+
+    void ParserRecord::applyUnits(std::shared_ptr<UnitSystem> activeUnits , std::shared_ptr<UnitSystem> defaultUnits , std::shared_ptr<const DeckRecord> deckRecord) const {
         for (auto iter=begin(); iter != end(); ++iter) {
             if ((*iter)->hasDimension()) {
                 std::shared_ptr<DeckItem> deckItem = deckRecord->getItem( (*iter)->name() );
                 std::shared_ptr<const ParserItem> parserItem = get( (*iter)->name() );
 
                 for (size_t idim=0; idim < (*iter)->numDimensions(); idim++) {
-                    std::shared_ptr<const Dimension> activeDimension  = deck->getActiveUnitSystem()->getNewDimension( parserItem->getDimension(idim) );
-                    std::shared_ptr<const Dimension> defaultDimension = deck->getDefaultUnitSystem()->getNewDimension( parserItem->getDimension(idim) );
+                    std::shared_ptr<const Dimension> activeDimension  = activeUnits->getNewDimension( parserItem->getDimension(idim) );
+                    std::shared_ptr<const Dimension> defaultDimension = defaultUnits->getNewDimension( parserItem->getDimension(idim) );
                     deckItem->push_backDimension( activeDimension , defaultDimension );
                 }
             }
@@ -115,8 +120,8 @@ namespace Opm {
     }
 
     DeckRecordConstPtr ParserRecord::parse(const ParseMode& parseMode , RawRecordPtr rawRecord) const {
-        std::string recordBeforeParsing = rawRecord->getRecordString();
-        DeckRecordPtr deckRecord(new DeckRecord());
+        DeckRecordPtr deckRecord = std::make_shared<DeckRecord>();
+        deckRecord->reserve( size() );
         for (size_t i = 0; i < size(); i++) {
             ParserItemConstPtr parserItem = get(i);
             DeckItemPtr deckItem = parserItem->scan(rawRecord);
@@ -126,7 +131,7 @@ namespace Opm {
         if (rawRecord->size() > 0) {
             std::string msg = "The RawRecord for keyword \""  + rawRecord->getKeywordName() + "\" in file\"" + rawRecord->getFileName() + "\" contained " +
                 std::to_string(rawRecord->size()) +
-                " too many items according to the spec. RawRecord was: " + recordBeforeParsing;
+                " too many items according to the spec. RawRecord was: " + rawRecord->getRecordString();
             parseMode.handleError(ParseMode::PARSE_EXTRA_DATA , msg);
         }
 
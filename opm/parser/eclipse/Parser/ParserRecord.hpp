@@ -46,6 +46,7 @@ namespace Opm {
         bool hasDimension() const;
         bool hasItem(const std::string& itemName) const;
         void applyUnitsToDeck(std::shared_ptr<const Deck> deck , std::shared_ptr<const DeckRecord> deckRecord) const;
+        void applyUnits(std::shared_ptr<UnitSystem> activeUnits , std::shared_ptr<UnitSystem> defaultUnits , std::shared_ptr<const DeckRecord> deckRecord) const;
         std::vector<ParserItemConstPtr>::const_iterator begin() const;
         std::vector<ParserItemConstPtr>::const_iterator end() const;
     private:
@@ -0,0 +1,313 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE DeckCacheTests
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Parser/DeckCache.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Deck/DeckRecord.hpp>
+#include <opm/parser/eclipse/Deck/DeckIntItem.hpp>
+#include <opm/parser/eclipse/Deck/DeckDoubleItem.hpp>
+#include <opm/parser/eclipse/Deck/DeckStringItem.hpp>
+
+using namespace Opm;
+
+namespace {
+
+    const char* deckData =
+        "RUNSPEC\n"
+        "FIELD\n"
+        "DIMENS\n"
+        " 2 2 1 /\n"
+        "TABDIMS\n"
+        " 1 /\n"
+        "GRID\n"
+        "INCLUDE\n"
+        " 'include.inc' /\n"
+        "PROPS\n"
+        "SWOF\n"
+        " 0.1 0.0 1.0 1*\n"
+        " 1.0 1.0 0.0 0.0 /\n"
+        "SCHEDULE\n"
+        "WELSPECS\n"
+        " 'PROD' 'G1' 1 1 1* 'OIL' /\n"
+        "/\n";
+
+    const char* includeData =
+        "PORO\n"
+        " 4*0.25 /\n"
+        "PERMX\n"
+        " 100 200 2*300 /\n";
+
+
+    class DeckDirectory {
+    public:
+        DeckDirectory() :
+            m_path( boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("DeckCache-%%%%%%") )
+        {
+            boost::filesystem::create_directories( m_path );
+            write( "CASE.DATA" , deckData );
+            write( "include.inc" , includeData );
+        }
+
+        ~DeckDirectory() {
+            boost::filesystem::remove_all( m_path );
+        }
+
+        void write(const std::string& fileName , const std::string& content) const {
+            std::ofstream stream( (m_path / fileName).string().c_str() );
+            stream << content;
+        }
+
+        std::string dataFile() const {
+            return (m_path / "CASE.DATA").string();
+        }
+
+        boost::filesystem::path path(const std::string& fileName) const {
+            return m_path / fileName;
+        }
+
+    private:
+        boost::filesystem::path m_path;
+    };
+
+
+    void checkEqual(DeckConstPtr deck1 , DeckConstPtr deck2) {
+        BOOST_REQUIRE_EQUAL( deck1->size() , deck2->size() );
+        for (size_t keywordIndex = 0; keywordIndex < deck1->size(); keywordIndex++) {
+            DeckKeywordConstPtr keyword1 = deck1->getKeyword( keywordIndex );
+            DeckKeywordConstPtr keyword2 = deck2->getKeyword( keywordIndex );
+
+            BOOST_CHECK_EQUAL( keyword1->name() , keyword2->name() );
+            BOOST_CHECK_EQUAL( keyword1->getFileName() , keyword2->getFileName() );
+            BOOST_CHECK_EQUAL( keyword1->getLineNumber() , keyword2->getLineNumber() );
+            BOOST_CHECK_EQUAL( keyword1->isKnown() , keyword2->isKnown() );
+            BOOST_CHECK_EQUAL( keyword1->isDataKeyword() , keyword2->isDataKeyword() );
+            BOOST_CHECK_EQUAL( keyword1->hasParserKeyword() , keyword2->hasParserKeyword() );
+            BOOST_REQUIRE_EQUAL( keyword1->size() , keyword2->size() );
+
+            for (size_t recordIndex = 0; recordIndex < keyword1->size(); recordIndex++) {
+                DeckRecordConstPtr record1 = keyword1->getRecord( recordIndex );
+                DeckRecordConstPtr record2 = keyword2->getRecord( recordIndex );
+                BOOST_REQUIRE_EQUAL( record1->size() , record2->size() );
+
+                for (size_t itemIndex = 0; itemIndex < record1->size(); itemIndex++) {
+                    DeckItemConstPtr item1 = record1->getItem( itemIndex );
+                    DeckItemConstPtr item2 = record2->getItem( itemIndex );
+
+                    BOOST_CHECK_EQUAL( item1->name() , item2->name() );
+                    BOOST_REQUIRE_EQUAL( item1->size() , item2->size() );
+                    for (size_t index = 0; index < item1->size(); index++) {
+                        BOOST_CHECK_EQUAL( item1->defaultApplied( index ) , item2->defaultApplied( index ));
+
+                        // defaulted values can be NaN
+                        if (item1->defaultApplied( index ))
+                            continue;
+
+                        if (std::dynamic_pointer_cast<const DeckIntItem>( item1 ))
+                            BOOST_CHECK_EQUAL( item1->getInt( index ) , item2->getInt( index ));
+                        else if (std::dynamic_pointer_cast<const DeckDoubleItem>( item1 )) {
+                            BOOST_CHECK_EQUAL( item1->getRawDouble( index ) , item2->getRawDouble( index ));
+                            BOOST_CHECK_EQUAL( item1->getSIDouble( index ) , item2->getSIDouble( index ));
+                        } else if (std::dynamic_pointer_cast<const DeckStringItem>( item1 ))
+                            BOOST_CHECK_EQUAL( item1->getString( index ) , item2->getString( index ));
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+    DeckDirectory deckDirectory;
+    ParserPtr parser(new Parser());
+    DeckCache cache( parser , DeckCache::defaultCacheFile( deckDirectory.dataFile() ));
+    DeckConstPtr deck = parser->parseFile( deckDirectory.dataFile() , ParseMode() );
+    std::stringstream stream;
+
+    cache.writeDeck( *deck , ParseMode() , stream );
+    DeckConstPtr loadedDeck = cache.readDeck( stream );
+
+    checkEqual( deck , loadedDeck );
+    BOOST_CHECK_EQUAL( 2U , loadedDeck->getInputFiles().size() );
+    BOOST_CHECK( loadedDeck->getActiveUnitSystem() );
+    BOOST_CHECK_EQUAL( deck->getActiveUnitSystem()->getName() , loadedDeck->getActiveUnitSystem()->getName() );
+}
+
+
+BOOST_AUTO_TEST_CASE(CorruptCacheThrows) {
+    DeckDirectory deckDirectory;
+    ParserPtr parser(new Parser());
+    DeckCache cache( parser , DeckCache::defaultCacheFile( deckDirectory.dataFile() ));
+    DeckConstPtr deck = parser->parseFile( deckDirectory.dataFile() , ParseMode() );
+    std::stringstream stream;
+
+    cache.writeDeck( *deck , ParseMode() , stream );
+    std::string content = stream.str();
+    std::stringstream truncated( content.substr( 0 , content.size() / 2 ));
+    BOOST_CHECK_THROW( cache.readDeck( truncated ) , std::runtime_error );
+
+    std::stringstream garbage( "This is not a deck cache" );
+    BOOST_CHECK_THROW( cache.readDeck( garbage ) , std::runtime_error );
+
+    // A huge length is rejected before anything is allocated.
+    const std::string name = deck->getKeyword( 0 )->name();
+    size_t namePos = content.find( name );
+    BOOST_REQUIRE( namePos != std::string::npos );
+    uint64_t hugeLength = static_cast<uint64_t>( 1 ) << 60;
+    std::string corrupt = content;
+    corrupt.replace( namePos - sizeof hugeLength , sizeof hugeLength , reinterpret_cast<const char*>( &hugeLength ) , sizeof hugeLength );
+    std::stringstream corruptStream( corrupt );
+    BOOST_CHECK_THROW( cache.readDeck( corruptStream ) , std::runtime_error );
+}
+
+
+BOOST_AUTO_TEST_CASE(CorruptCacheIsACacheMiss) {
+    DeckDirectory deckDirectory;
+    ParserPtr parser(new Parser());
+    boost::filesystem::path cacheFile = DeckCache::defaultCacheFile( deckDirectory.dataFile() );
+    DeckCache cache( parser , cacheFile );
+    DeckConstPtr deck = cache.parseFile( deckDirectory.dataFile() , ParseMode() );
+
+    {
+        // Keep the header, cut the keywords.
+        std::ifstream input( cacheFile.string().c_str() , std::ios::binary );
+        std::string content( (std::istreambuf_iterator<char>( input )) , std::istreambuf_iterator<char>() );
+        input.close();
+        std::ofstream output( cacheFile.string().c_str() , std::ios::binary );
+        output << content.substr( 0 , content.size() - 16 );
+    }
+
+    DeckConstPtr newDeck = cache.parseFile( deckDirectory.dataFile() , ParseMode() );
+    BOOST_CHECK( !cache.loadedFromCache() );
+    checkEqual( deck , newDeck );
+
+    cache.parseFile( deckDirectory.dataFile() , ParseMode() );
+    BOOST_CHECK( cache.loadedFromCache() );
+}
+
+
+BOOST_AUTO_TEST_CASE(ConfigurationIsPartOfTheKey) {
+    DeckDirectory deckDirectory;
+    ParserPtr parser(new Parser());
+    DeckCache cache( parser , DeckCache::defaultCacheFile( deckDirectory.dataFile() ));
+    ParseMode parseMode;
+
+    cache.parseFile( deckDirectory.dataFile() , parseMode );
+    BOOST_CHECK( cache.isValid( deckDirectory.dataFile() , parseMode ));
+
+    {
+        ParseMode otherMode;
+        otherMode.update( InputError::IGNORE );
+        BOOST_CHECK( !cache.isValid( deckDirectory.dataFile() , otherMode ));
+    }
+
+    parser->setLazyKeywords( true );
+    BOOST_CHECK( !cache.isValid( deckDirectory.dataFile() , parseMode ));
+    parser->setLazyKeywords( false );
+
+    parser->setEagerUnitConversion( true );
+    BOOST_CHECK( !cache.isValid( deckDirectory.dataFile() , parseMode ));
+    parser->setEagerUnitConversion( false );
+
+    BOOST_CHECK( parser->dropParserKeyword( "SWOF" ));
+    BOOST_CHECK( !cache.isValid( deckDirectory.dataFile() , parseMode ));
+}
+
+
+BOOST_AUTO_TEST_CASE(CacheIsReusedUntilInputChanges) {
+    DeckDirectory deckDirectory;
+    ParserPtr parser(new Parser());
+    boost::filesystem::path cacheFile = DeckCache::defaultCacheFile( deckDirectory.dataFile() );
+    DeckCache cache( parser , cacheFile );
+
+    BOOST_CHECK( !cache.isValid( deckDirectory.dataFile() , ParseMode() ));
+    DeckConstPtr deck = cache.parseFile( deckDirectory.dataFile() , ParseMode() );
+    BOOST_CHECK( !cache.loadedFromCache() );
+    BOOST_CHECK( boost::filesystem::exists( cacheFile ));
+
+    {
+        DeckConstPtr cachedDeck = cache.parseFile( deckDirectory.dataFile() , ParseMode() );
+        BOOST_CHECK( cache.loadedFromCache() );
+        checkEqual( deck , cachedDeck );
+    }
+
+    // New modification time, same content: the cache is still valid.
+    {
+        boost::filesystem::path includeFile = deckDirectory.path( "include.inc" );
+        boost::filesystem::last_write_time( includeFile , boost::filesystem::last_write_time( includeFile ) + 10 );
+        BOOST_CHECK( cache.isValid( deckDirectory.dataFile() , ParseMode() ));
+    }
+
+    // Changed content in the include file: the deck is parsed again.
+    {
+        deckDirectory.write( "include.inc" , "PORO\n 4*0.30 /\nPERMX\n 100 200 2*300 /\n" );
+        BOOST_CHECK( !cache.isValid( deckDirectory.dataFile() , ParseMode() ));
+
+        DeckConstPtr newDeck = cache.parseFile( deckDirectory.dataFile() , ParseMode() );
+        BOOST_CHECK( !cache.loadedFromCache() );
+        BOOST_CHECK_EQUAL( 0.30 , newDeck->getKeyword("PORO")->getRawDoubleData()[0] );
+        BOOST_CHECK( cache.isValid( deckDirectory.dataFile() , ParseMode() ));
+    }
+
+    // The cache belongs to one data file only.
+    BOOST_CHECK( !cache.isValid( deckDirectory.path( "include.inc" ).string() , ParseMode() ));
+}
+
+
+BOOST_AUTO_TEST_CASE(FailedWriteKeepsTheDeck) {
+    DeckDirectory deckDirectory;
+    ParserPtr parser(new Parser());
+
+    // The cache directory does not exist: the deck is still returned.
+    {
+        boost::filesystem::path cacheFile = deckDirectory.path( "missing/deck.cache" );
+        DeckCache cache( parser , cacheFile );
+        DeckConstPtr deck = cache.parseFile( deckDirectory.dataFile() , ParseMode() );
+        BOOST_CHECK( !cache.loadedFromCache() );
+        BOOST_CHECK( deck->hasKeyword( "PORO" ));
+        BOOST_CHECK( !boost::filesystem::exists( cacheFile ));
+    }
+
+    // In place SI conversion: the cache is skipped.
+    {
+        boost::filesystem::path cacheFile = DeckCache::defaultCacheFile( deckDirectory.dataFile() );
+        DeckCache cache( parser , cacheFile );
+        parser->setEagerUnitConversion( true , false );
+        DeckConstPtr deck = cache.parseFile( deckDirectory.dataFile() , ParseMode() );
+        BOOST_CHECK( deck->hasKeyword( "PORO" ));
+        BOOST_CHECK( !boost::filesystem::exists( cacheFile ));
+
+        boost::filesystem::path tmpFile = cacheFile;
+        tmpFile += ".tmp";
+        BOOST_CHECK( !boost::filesystem::exists( tmpFile ));
+    }
+}
@@ -0,0 +1,133 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE KeywordMatcherTests
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/parser/eclipse/Parser/KeywordMatcher.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParserKeyword.hpp>
+
+using namespace Opm;
+
+
+BOOST_AUTO_TEST_CASE(EmptyMatcherMatchesNothing) {
+    KeywordMatcher matcher;
+    BOOST_CHECK_EQUAL( -1 , matcher.match( "" ));
+    BOOST_CHECK_EQUAL( -1 , matcher.match( "WOPR" ));
+    BOOST_CHECK_EQUAL( 0U , matcher.numPatterns() );
+}
+
+
+BOOST_AUTO_TEST_CASE(MatchIsCompleteName) {
+    KeywordMatcher matcher;
+    BOOST_CHECK( matcher.addPattern( "TVDP.+" , 0 ));
+    matcher.compile();
+
+    BOOST_CHECK_EQUAL( 0 , matcher.match( "TVDPA" ));
+    BOOST_CHECK_EQUAL( 0 , matcher.match( "TVDPXXX" ));
+    BOOST_CHECK_EQUAL( -1 , matcher.match( "TVDP" ));
+    BOOST_CHECK_EQUAL( -1 , matcher.match( "XTVDPA" ));
+    BOOST_CHECK_EQUAL( -1 , matcher.match( "TVD" ));
+}
+
+
+BOOST_AUTO_TEST_CASE(SmallestIdWins) {
+    KeywordMatcher matcher;
+    BOOST_CHECK( matcher.addPattern( "WU.+" , 3 ));
+    BOOST_CHECK( matcher.addPattern( "W.+" , 1 ));
+    matcher.addName( "WUX" , 2 );
+    matcher.compile();
+
+    BOOST_CHECK_EQUAL( 1 , matcher.match( "WUX" ));
+    BOOST_CHECK_EQUAL( 1 , matcher.match( "WUABC" ));
+    BOOST_CHECK_EQUAL( 1 , matcher.match( "WOPR" ));
+    BOOST_CHECK_EQUAL( -1 , matcher.match( "W" ));
+}
+
+
+BOOST_AUTO_TEST_CASE(UnsupportedPatternIsRejected) {
+    KeywordMatcher matcher;
+    BOOST_CHECK( !matcher.addPattern( "A{2}" , 0 ));
+    BOOST_CHECK( !matcher.addPattern( "^A" , 0 ));
+    BOOST_CHECK( !matcher.addPattern( "[[:alpha:]]" , 0 ));
+    BOOST_CHECK( !matcher.addPattern( "(AB" , 0 ));
+    BOOST_CHECK( !matcher.addPattern( "AB)" , 0 ));
+    BOOST_CHECK( !matcher.addPattern( "+A" , 0 ));
+    BOOST_CHECK_EQUAL( 0U , matcher.numPatterns() );
+
+    BOOST_CHECK( matcher.addPattern( "AB" , 1 ));
+    matcher.compile();
+    BOOST_CHECK_EQUAL( 1 , matcher.match( "AB" ));
+    BOOST_CHECK_EQUAL( -1 , matcher.match( "AA" ));
+}
+
+
+BOOST_AUTO_TEST_CASE(MatchesLikeRegex) {
+    const std::vector<std::string> patterns = {
+        "R[OGW]?[IP][PRT]_.+|RU.+|RTIP[1-9][0-9]*.+",
+        "(WBHWC|WGFWC|WOFWC|WWFWC)[1-9][0-9]?|WTPR.+",
+        "A(B|C)*D|X?Y+|[^A-Z]Q|\\.Z|[]A-]K|()E" };
+    const std::vector<std::string> names = {
+        "ROPR_1", "RPT_X", "RGPR_", "RXPR_A", "RUABC", "RU", "RTIP12X", "RTIP0X",
+        "WBHWC1", "WOFWC12", "WOFWC123", "WWFWC0", "WTPRA", "WTPR",
+        "AD", "ABCBD", "ABXD", "Y", "XYYY", "XX", "1Q", "AQ", ".Z", "AZ", "]K", "AK", "-K", "BK", "E", "" };
+
+    for (const auto& pattern : patterns) {
+        KeywordMatcher matcher;
+        std::regex regex( pattern , std::regex::extended );
+
+        BOOST_REQUIRE( matcher.addPattern( pattern , 7 ));
+        matcher.compile();
+        for (const auto& name : names) {
+            BOOST_TEST_MESSAGE( pattern << " : " << name );
+            BOOST_CHECK_EQUAL( std::regex_match( name , regex ) ? 7 : -1 , matcher.match( name ));
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(ParserUsesMatcher) {
+    ParserPtr parser(new Parser());
+
+    BOOST_CHECK( parser->isRecognizedKeyword( "WUOPR" ));
+    BOOST_CHECK( parser->isRecognizedKeyword( "WOFWC1" ));
+    BOOST_CHECK( parser->isRecognizedKeyword( "ROPR_ABC" ));
+    BOOST_CHECK( !parser->isRecognizedKeyword( "WOFWC" ));
+    BOOST_CHECK( !parser->isRecognizedKeyword( "XUOPR" ));
+
+    BOOST_CHECK_EQUAL( "WELL_PROBE" , parser->getParserKeywordFromDeckName( "WUOPR" )->getName() );
+    BOOST_CHECK_EQUAL( "REGION_PROBE" , parser->getParserKeywordFromDeckName( "ROPR_ABC" )->getName() );
+
+    // A pattern the matcher can not compile is still matched with the regex.
+    ParserKeywordPtr keyword = std::make_shared<ParserKeyword>( "XBOUNDED" );
+    keyword->setMatchRegex( "X{2}[A-Z]+" );
+    parser->addParserKeyword( keyword );
+    BOOST_CHECK( parser->isRecognizedKeyword( "XXABC" ));
+    BOOST_CHECK( !parser->isRecognizedKeyword( "XABC" ));
+
+    parser->dropParserKeyword( "WELL_PROBE" );
+    BOOST_CHECK( !parser->isRecognizedKeyword( "WUOPR" ));
+    BOOST_CHECK( parser->isRecognizedKeyword( "XXABC" ));
+}
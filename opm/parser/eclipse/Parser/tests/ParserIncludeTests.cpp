@@ -19,6 +19,9 @@
 
 
 #define BOOST_TEST_MODULE ParserTests
+#include <algorithm>
+#include <set>
+#include <string>
 #include <boost/test/unit_test.hpp>
 
 #include <opm/parser/eclipse/Parser/Parser.hpp>
@@ -70,3 +73,59 @@ BOOST_AUTO_TEST_CASE(ParserKeyword_includeWrongCase) {
 #endif
 }
 
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_includeParallel) {
+    boost::filesystem::path inputFilePath("testdata/parser/includeParallel.data");
+
+    Opm::ParserPtr parser(new Opm::Parser());
+    Opm::DeckConstPtr sequentialDeck = parser->parseFile(inputFilePath.string() , Opm::ParseMode());
+
+    parser->setNumIncludeThreads( 4 );
+    BOOST_CHECK_EQUAL( 4U , parser->getNumIncludeThreads() );
+    Opm::DeckConstPtr parallelDeck = parser->parseFile(inputFilePath.string() , Opm::ParseMode());
+
+    BOOST_CHECK_EQUAL( sequentialDeck->size() , parallelDeck->size() );
+    for (size_t index = 0; index < std::min( sequentialDeck->size() , parallelDeck->size() ); index++) {
+        Opm::DeckKeywordConstPtr sequentialKeyword = sequentialDeck->getKeyword( index );
+        Opm::DeckKeywordConstPtr parallelKeyword = parallelDeck->getKeyword( index );
+
+        BOOST_CHECK_EQUAL( sequentialKeyword->name() , parallelKeyword->name() );
+        BOOST_CHECK_EQUAL( sequentialKeyword->size() , parallelKeyword->size() );
+        BOOST_CHECK_EQUAL( index , parallelDeck->getKeywordIndex( parallelKeyword ));
+    }
+
+    BOOST_CHECK_EQUAL( 2U , parallelDeck->numKeywords("SWOF"));
+    BOOST_CHECK_EQUAL( 1U , parallelDeck->getKeyword("SWOF" , 0)->size());
+    BOOST_CHECK_EQUAL( 2U , parallelDeck->getKeyword("SWOF" , 1)->size());
+    BOOST_CHECK( parallelDeck->hasKeyword("MULTX"));
+
+    {
+        const auto& sequentialData = sequentialDeck->getKeyword("PERMX")->getSIDoubleData();
+        const auto& parallelData = parallelDeck->getKeyword("PERMX")->getSIDoubleData();
+        BOOST_CHECK_EQUAL_COLLECTIONS( sequentialData.begin() , sequentialData.end() , parallelData.begin() , parallelData.end() );
+    }
+
+    {
+        const auto& poro = parallelDeck->getKeyword("PORO")->getSIDoubleData();
+        BOOST_CHECK_EQUAL( 8U , poro.size() );
+        BOOST_CHECK_EQUAL( 0.25 , poro[0] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_includeParallelInvalid) {
+    boost::filesystem::path inputFilePath("testdata/parser/includeInvalid.data");
+
+    Opm::ParserPtr parser(new Opm::Parser());
+    parser->setNumIncludeThreads( 4 );
+    BOOST_CHECK_THROW(parser->parseFile(inputFilePath.string() , Opm::ParseMode()), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_includeBarrierKeywords) {
+    const std::set<std::string> barrierKeywords = { "TABDIMS" , "SOLUTION" };
+
+    BOOST_CHECK( Opm::Parser::isIndependentInclude( "testdata/parser/includeBarrier/data.inc" , barrierKeywords ));
+    BOOST_CHECK( !Opm::Parser::isIndependentInclude( "testdata/parser/includeBarrier/indented.inc" , barrierKeywords ));
+    BOOST_CHECK( !Opm::Parser::isIndependentInclude( "testdata/parser/includeBarrier/long.inc" , barrierKeywords ));
+    BOOST_CHECK( !Opm::Parser::isIndependentInclude( "testdata/parser/includeBarrier/lowercase.inc" , barrierKeywords ));
+    BOOST_CHECK( Opm::Parser::isIndependentInclude( "testdata/parser/includeBarrier/long.inc" , { "TABDIMS" } ));
+}
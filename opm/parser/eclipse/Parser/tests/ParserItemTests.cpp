@@ -776,3 +776,25 @@ BOOST_AUTO_TEST_CASE(ParserFloatItemGetDimension) {
     BOOST_CHECK_THROW( floatItem.getDimension( 3 ) , std::invalid_argument );
 }
 
+
+BOOST_AUTO_TEST_CASE(Scan_All_AfterSingleItem) {
+    ParserIntItem itemSingle("ITEM1", SINGLE);
+    ParserDoubleItem itemAll("ITEM2", ALL);
+
+    RawRecordPtr rawRecord(new RawRecord("3 1.5 2*0.25 1D2 /"));
+    DeckItemConstPtr deckIntItem = itemSingle.scan(rawRecord);
+    DeckItemConstPtr deckDoubleItem = itemAll.scan(rawRecord);
+
+    BOOST_CHECK_EQUAL(3, deckIntItem->getInt(0));
+    BOOST_CHECK_EQUAL(4U, deckDoubleItem->size());
+    BOOST_CHECK_EQUAL(1.5, deckDoubleItem->getRawDouble(0));
+    BOOST_CHECK_EQUAL(0.25, deckDoubleItem->getRawDouble(2));
+    BOOST_CHECK_EQUAL(100, deckDoubleItem->getRawDouble(3));
+    BOOST_CHECK_EQUAL(0U, rawRecord->size());
+}
+
+BOOST_AUTO_TEST_CASE(CountRecordValues) {
+    BOOST_CHECK_EQUAL(0U, countRecordValues(""));
+    BOOST_CHECK_EQUAL(3U, countRecordValues(" 1 2\t3 "));
+    BOOST_CHECK_EQUAL(16U, countRecordValues("1 10*0.25 * 4*"));
+}
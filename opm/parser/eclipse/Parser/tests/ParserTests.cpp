@@ -17,7 +17,10 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 #include <iostream>
 #include <boost/filesystem.hpp>
 #define BOOST_TEST_MODULE ParserTests
@@ -25,8 +28,14 @@
 
 #include <opm/json/JsonObject.hpp>
 
+#include <opm/parser/eclipse/OpmLog/OpmLog.hpp>
+#include <opm/parser/eclipse/OpmLog/ProfileLog.hpp>
 #include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Parser/ParseMode.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/Parser/ParserKeyword.hpp>
+#include <opm/parser/eclipse/Parser/ParserKeywords.hpp>
 
 #include <opm/parser/eclipse/Parser/ParserIntItem.hpp>
 #include <opm/parser/eclipse/Parser/ParserStringItem.hpp>
@@ -331,3 +340,236 @@ BOOST_AUTO_TEST_CASE( quoted_comments ) {
 
 
 
+
+
+BOOST_AUTO_TEST_CASE( eager_unit_conversion ) {
+    const char* deckString =
+        "RUNSPEC\n"
+        "FIELD\n"
+        "DIMENS\n"
+        " 2 1 1 /\n"
+        "GRID\n"
+        "DX\n"
+        " 2*100 /\n";
+
+    ParserPtr parser(new Parser());
+    DeckConstPtr lazyDeck = parser->parseString( deckString , ParseMode() );
+
+    parser->setEagerUnitConversion( true );
+    BOOST_CHECK( parser->getEagerUnitConversion() );
+    DeckConstPtr eagerDeck = parser->parseString( deckString , ParseMode() );
+    BOOST_CHECK_EQUAL( 100 , eagerDeck->getKeyword("DX")->getRawDoubleData()[0] );
+    BOOST_CHECK( lazyDeck->getKeyword("DX")->getSIDoubleData() == eagerDeck->getKeyword("DX")->getSIDoubleData() );
+
+    parser->setEagerUnitConversion( true , false );
+    DeckConstPtr inPlaceDeck = parser->parseString( deckString , ParseMode() );
+    BOOST_CHECK_THROW( inPlaceDeck->getKeyword("DX")->getRawDoubleData() , std::logic_error );
+    BOOST_CHECK( lazyDeck->getKeyword("DX")->getSIDoubleData() == inPlaceDeck->getKeyword("DX")->getSIDoubleData() );
+}
+
+
+BOOST_AUTO_TEST_CASE( keyword_ids ) {
+    ParserPtr parser(new Parser());
+    DeckConstPtr deck = parser->parseString( "RUNSPEC\nDIMENS\n 10 10 10 /\n" , ParseMode() );
+
+    BOOST_CHECK_EQUAL( ParserKeywords::RUNSPEC::keywordId , deck->getKeyword("RUNSPEC")->getKeywordId() );
+    BOOST_CHECK_EQUAL( ParserKeywords::DIMENS::keywordId , deck->getKeyword("DIMENS")->getKeywordId() );
+    BOOST_CHECK( ParserKeywords::RUNSPEC::keywordId != ParserKeywords::DIMENS::keywordId );
+    BOOST_CHECK( ParserKeywords::DIMENS::keywordId < ParserKeywords::numKeywordIds );
+
+    DeckKeyword manualKeyword("DIMENS");
+    BOOST_CHECK_EQUAL( -1 , manualKeyword.getKeywordId() );
+    BOOST_CHECK_EQUAL( ParserKeywords::DIMENS::keywordId , ParserKeywords::getKeywordId( manualKeyword ));
+    BOOST_CHECK_EQUAL( -1 , ParserKeywords::getKeywordId( "NOT_A_KEYWORD" ));
+}
+
+
+BOOST_AUTO_TEST_CASE( stream_keywords ) {
+    const char* deckString =
+        "RUNSPEC\n"
+        "FIELD\n"
+        "TABDIMS\n"
+        " 2 /\n"
+        "PROPS\n"
+        "SWOF\n"
+        " 0.1 0.0 1.0 0.0 /\n"
+        " 0.2 0.0 1.0 0.0 /\n"
+        "GRID\n"
+        "DX\n"
+        " 2*100 /\n"
+        "NOTAKEYWORD\n"
+        "DY\n"
+        " 2*100 /\n";
+
+    ParseMode parseMode;
+    parseMode.update( ParseMode::PARSE_UNKNOWN_KEYWORD , InputError::IGNORE );
+    ParserPtr parser(new Parser());
+    DeckConstPtr deck = parser->parseString( deckString , parseMode );
+
+    std::vector<DeckKeywordConstPtr> keywords;
+    parser->streamString( deckString , parseMode , [&keywords](DeckKeywordConstPtr keyword) {
+            keywords.push_back( keyword );
+            return true;
+        });
+
+    BOOST_REQUIRE_EQUAL( deck->size() , keywords.size() );
+    for (size_t index = 0; index < keywords.size(); index++) {
+        BOOST_CHECK_EQUAL( deck->getKeyword( index )->name() , keywords[index]->name() );
+        BOOST_CHECK_EQUAL( deck->getKeyword( index )->getLineNumber() , keywords[index]->getLineNumber() );
+        BOOST_CHECK_EQUAL( deck->getKeyword( index )->size() , keywords[index]->size() );
+    }
+    BOOST_CHECK_EQUAL( "DX" , keywords[6]->name() );
+    BOOST_CHECK( deck->getKeyword("DX")->getSIDoubleData() == keywords[6]->getSIDoubleData() );
+
+    // Stop after the first keyword with dimensions.
+    size_t numKeywords = 0;
+    parser->streamString( deckString , parseMode , [&numKeywords](DeckKeywordConstPtr keyword) {
+            numKeywords++;
+            return keyword->name() != "SWOF";
+        });
+    BOOST_CHECK_EQUAL( 5U , numKeywords );
+}
+
+
+BOOST_AUTO_TEST_CASE( section_selective_parsing ) {
+    const char* deckString =
+        "RUNSPEC\n"
+        "FIELD\n"
+        "TABDIMS\n"
+        " 2 /\n"
+        "GRID\n"
+        "DX\n"
+        " 2*100 /\n"
+        "PROPS\n"
+        "SWOF\n"
+        " 0.1 0.0 1.0 0.0 /\n"
+        " 0.2 0.0 1.0 0.0 /\n"
+        "SCHEDULE\n"
+        "WELSPECS\n"
+        " 'W1' 'G1' 1 1 1* 'OIL' /\n"
+        "/\n"
+        "TSTEP\n"
+        " 1 /\n";
+
+    ParserPtr parser(new Parser());
+    BOOST_CHECK( !parser->hasParseSelection() );
+    BOOST_CHECK_THROW( parser->setParseSections( { "GRID" , "NOT_A_SECTION" } ) , std::invalid_argument );
+
+    parser->setParseSections( { "GRID" } );
+    BOOST_CHECK( parser->hasParseSelection() );
+    {
+        DeckConstPtr deck = parser->parseString( deckString , ParseMode() );
+        BOOST_CHECK( deck->hasKeyword("RUNSPEC") );
+        BOOST_CHECK( deck->hasKeyword("TABDIMS") );
+        BOOST_CHECK( deck->hasKeyword("FIELD") );
+        BOOST_CHECK( deck->hasKeyword("DX") );
+        BOOST_CHECK( deck->hasKeyword("SCHEDULE") );
+        BOOST_CHECK( !deck->hasKeyword("SWOF") );
+        BOOST_CHECK( !deck->hasKeyword("WELSPECS") );
+        BOOST_CHECK( !deck->hasKeyword("TSTEP") );
+        BOOST_CHECK_EQUAL( "Field" , deck->getActiveUnitSystem()->getName() );
+    }
+
+    parser->setParseKeywords( { "TSTEP" } );
+    {
+        DeckConstPtr deck = parser->parseString( deckString , ParseMode() );
+        BOOST_CHECK( deck->hasKeyword("DX") );
+        BOOST_CHECK( deck->hasKeyword("TSTEP") );
+        BOOST_CHECK( !deck->hasKeyword("WELSPECS") );
+    }
+
+    parser->setParseSections( { } );
+    parser->setParseKeywords( { } );
+    {
+        DeckConstPtr deck = parser->parseString( deckString , ParseMode() );
+        BOOST_CHECK_EQUAL( 2U , deck->getKeyword("SWOF")->size() );
+        BOOST_CHECK( deck->hasKeyword("WELSPECS") );
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE( lazy_keywords ) {
+    const char* deckString =
+        "RUNSPEC\n"
+        "FIELD\n"
+        "TABDIMS\n"
+        " 2 /\n"
+        "GRID\n"
+        "DX\n"
+        " 2*100 /\n"
+        "PORO\n"
+        " 0.25 X /\n"
+        "PROPS\n"
+        "SWOF\n"
+        " 0.1 0.0 1.0 0.0 /\n"
+        " 0.2 0.0 1.0 0.0 /\n";
+
+    ParserPtr parser(new Parser());
+    DeckConstPtr eagerDeck = parser->parseString( "FIELD\nDX\n 2*100 /\n" , ParseMode() );
+
+    parser->setLazyKeywords( true );
+    BOOST_CHECK( parser->getLazyKeywords() );
+    DeckConstPtr deck = parser->parseString( deckString , ParseMode() );
+
+    BOOST_CHECK( deck->getKeyword("TABDIMS")->isParsed() );
+    BOOST_CHECK( !deck->getKeyword("SWOF")->isParsed() );
+    BOOST_CHECK_EQUAL( 2U , deck->getKeyword("SWOF")->size() );
+    BOOST_CHECK( deck->getKeyword("SWOF")->isParsed() );
+
+    // concurrent first access parses the keyword once, with units
+    DeckKeywordConstPtr dx = deck->getKeyword("DX");
+    std::vector<const std::vector<double>*> siData( 4 );
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < siData.size(); index++)
+        threads.emplace_back( [&siData , dx , index]() { siData[index] = &dx->getSIDoubleData(); } );
+    for (auto& thread : threads)
+        thread.join();
+    for (const auto* data : siData)
+        BOOST_CHECK_EQUAL( data , siData[0] );
+    BOOST_CHECK_EQUAL( eagerDeck->getKeyword("DX")->getSIDoubleData()[1] , (*siData[0])[1] );
+
+    // the lazy keywords honour the in place conversion
+    parser->setEagerUnitConversion( true , false );
+    DeckConstPtr inPlaceDeck = parser->parseString( deckString , ParseMode() );
+    BOOST_CHECK_EQUAL( (*siData[0])[1] , inPlaceDeck->getKeyword("DX")->getSIDoubleData()[1] );
+    BOOST_CHECK_THROW( inPlaceDeck->getKeyword("DX")->getRawDoubleData() , std::logic_error );
+    parser->setEagerUnitConversion( false );
+
+    // the error in PORO is reported on every access
+    BOOST_CHECK_THROW( deck->getKeyword("PORO")->getRawDoubleData() , std::invalid_argument );
+    BOOST_CHECK_THROW( deck->getKeyword("PORO")->size() , std::invalid_argument );
+}
+
+
+BOOST_AUTO_TEST_CASE( profile_keywords ) {
+    const char* deckString =
+        "RUNSPEC\n"
+        "DIMENS\n"
+        " 2 1 1 /\n"
+        "GRID\n"
+        "DX\n"
+        " 2*100 /\n"
+        "DX\n"
+        " 100 200 /\n";
+
+    ParserPtr parser(new Parser());
+    std::shared_ptr<ProfileLog> profileLog = std::make_shared<ProfileLog>();
+    OpmLog::addBackend( ProfileLog::BackendName , profileLog );
+    parser->parseString( deckString , ParseMode() );
+    OpmLog::removeBackend( ProfileLog::BackendName );
+
+    ProfileLog::Sample dx = profileLog->getSample( "keyword" , "DX" );
+    BOOST_CHECK_EQUAL( 2U , dx.count );
+    BOOST_CHECK_EQUAL( 2U , dx.records );
+    BOOST_CHECK_EQUAL( 4U , dx.values );
+    BOOST_CHECK( dx.bytes >= 20U );
+
+    ProfileLog::Sample file = profileLog->getSample( "file" , "<input>" );
+    BOOST_CHECK_EQUAL( std::strlen( deckString ) , file.bytes );
+    BOOST_CHECK_EQUAL( 7U , file.values );
+
+    // without the backend nothing is recorded
+    profileLog->clear();
+    parser->parseString( deckString , ParseMode() );
+    BOOST_CHECK_EQUAL( 0U , profileLog->getCategories().size() );
+}
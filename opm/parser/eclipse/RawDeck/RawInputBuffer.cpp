@@ -0,0 +1,159 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <opm/parser/eclipse/RawDeck/RawInputBuffer.hpp>
+
+namespace Opm {
+
+    RawInputBuffer::RawInputBuffer(const boost::filesystem::path& inputFile) :
+        m_mapping( nullptr ),
+        m_mappingSize( 0 ),
+        m_releasePages( false )
+    {
+        if (!mapFile( inputFile ))
+            readFile( inputFile );
+    }
+
+
+    RawInputBuffer::RawInputBuffer(const std::string& input) :
+        m_data( input ),
+        m_mapping( nullptr ),
+        m_mappingSize( 0 ),
+        m_releasePages( false )
+    {
+        m_begin = m_data.data();
+        m_end = m_begin + m_data.size();
+        m_current = m_begin;
+        m_released = m_begin;
+    }
+
+
+    RawInputBuffer::~RawInputBuffer() {
+        if (m_mapping)
+            munmap( m_mapping , m_mappingSize );
+    }
+
+
+    /*
+      Only regular, non-empty files are mapped; for everything else
+      (pipes, character devices, empty files, or when mmap() itself
+      fails) false is returned and the caller falls back to reading the
+      file into memory.
+    */
+
+    bool RawInputBuffer::mapFile(const boost::filesystem::path& inputFile) {
+        int fd = open( inputFile.string().c_str() , O_RDONLY );
+        if (fd < 0)
+            throw std::runtime_error(std::string("Input file '") +
+                                     inputFile.string() +
+                                     std::string("' does not exist or is not readable"));
+
+        struct stat fileStat;
+        if (fstat( fd , &fileStat ) != 0 || !S_ISREG( fileStat.st_mode ) || fileStat.st_size == 0) {
+            close( fd );
+            return false;
+        }
+
+        void* mapping = mmap( nullptr , fileStat.st_size , PROT_READ , MAP_PRIVATE , fd , 0 );
+        close( fd );
+        if (mapping == MAP_FAILED)
+            return false;
+
+        madvise( mapping , fileStat.st_size , MADV_SEQUENTIAL );
+        m_mapping = mapping;
+        m_mappingSize = fileStat.st_size;
+        m_begin = static_cast<const char*>( mapping );
+        m_end = m_begin + m_mappingSize;
+        m_current = m_begin;
+        m_released = m_begin;
+        return true;
+    }
+
+
+    void RawInputBuffer::readFile(const boost::filesystem::path& inputFile) {
+        std::ifstream stream( inputFile.string().c_str() , std::ios::binary );
+        if (!stream.is_open())
+            throw std::runtime_error(std::string("Input file '") +
+                                     inputFile.string() +
+                                     std::string("' does not exist or is not readable"));
+
+        std::ostringstream content;
+        content << stream.rdbuf();
+        m_data = content.str();
+
+        m_begin = m_data.data();
+        m_end = m_begin + m_data.size();
+        m_current = m_begin;
+        m_released = m_begin;
+    }
+
+
+    bool RawInputBuffer::getLine(string_view& line) {
+        if (m_current == m_end)
+            return false;
+
+        // everything before m_current has been consumed; it is released
+        // in chunks of 4 MB to keep the number of madvise() calls down.
+        if (m_releasePages && static_cast<size_t>(m_current - m_released) >= (4U << 20))
+            releasePages();
+
+        const void* newline = std::memchr( m_current , '\n' , m_end - m_current );
+        const char* lineEnd = newline ? static_cast<const char*>( newline ) : m_end;
+
+        line = string_view( m_current , lineEnd );
+        m_current = newline ? lineEnd + 1 : m_end;
+        return true;
+    }
+
+
+    void RawInputBuffer::releaseConsumedPages(bool release) {
+        m_releasePages = release && isMapped();
+    }
+
+
+    void RawInputBuffer::releasePages() {
+        const size_t pageSize = sysconf( _SC_PAGESIZE );
+        const char* releaseEnd = m_begin + ((m_current - m_begin) / pageSize) * pageSize;
+
+        if (releaseEnd > m_released) {
+            madvise( const_cast<char*>( m_released ) , releaseEnd - m_released , MADV_DONTNEED );
+            m_released = releaseEnd;
+        }
+    }
+
+
+    size_t RawInputBuffer::size() const {
+        return m_end - m_begin;
+    }
+
+
+    bool RawInputBuffer::isMapped() const {
+        return m_mapping != nullptr;
+    }
+}
@@ -0,0 +1,80 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RAW_INPUT_BUFFER_HPP
+#define RAW_INPUT_BUFFER_HPP
+
+#include <memory>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include <opm/parser/eclipse/Utility/Stringview.hpp>
+
+namespace Opm {
+
+    /// The complete content of one input file (or string) held in
+    /// memory. Regular files are memory mapped, anything else is read
+    /// into an internal buffer. The buffer is consumed line by line
+    /// through getLine(), which returns views into the buffer instead
+    /// of copying every line into a std::string.
+
+    class RawInputBuffer {
+    public:
+        explicit RawInputBuffer(const boost::filesystem::path& inputFile);
+        explicit RawInputBuffer(const std::string& input);
+        ~RawInputBuffer();
+
+        /// Works like std::getline(): the line is returned without the
+        /// trailing '\n', and false is returned when the buffer is
+        /// exhausted.
+        bool getLine(string_view& line);
+
+        size_t size() const;
+        bool isMapped() const;
+
+        /// For mapped files the pages consumed by getLine() are given
+        /// back to the kernel as the reading proceeds, so the resident
+        /// memory does not grow with the file size. Views returned
+        /// earlier stay valid; the pages are read from the file again
+        /// if they are accessed.
+        void releaseConsumedPages(bool release);
+
+    private:
+        RawInputBuffer(const RawInputBuffer&) = delete;
+        RawInputBuffer& operator=(const RawInputBuffer&) = delete;
+
+        bool mapFile(const boost::filesystem::path& inputFile);
+        void readFile(const boost::filesystem::path& inputFile);
+        void releasePages();
+
+        std::string m_data;
+        void* m_mapping;
+        size_t m_mappingSize;
+        const char* m_begin;
+        const char* m_end;
+        const char* m_current;
+        bool m_releasePages;
+        const char* m_released;
+    };
+
+    typedef std::shared_ptr<RawInputBuffer> RawInputBufferPtr;
+}
+
+#endif
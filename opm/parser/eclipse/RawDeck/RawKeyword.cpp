@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <stdexcept>
+#include <cctype>
 #include <regex.h>
 #include <boost/algorithm/string.hpp>
 #include "RawKeyword.hpp"
@@ -58,6 +59,9 @@ namespace Opm {
         m_lineNR = lineNR;
         m_isFinished = false;
         m_currentNumTables = 0;
+        m_skipRecords = false;
+        m_numSkippedRecords = 0;
+        m_partialFirstChar = 0;
     }
 
 
@@ -75,8 +79,14 @@ namespace Opm {
     /// Important method, being repeatedly called. When a record is terminated,
     /// it is added to the list of records, and a new record is started.
 
-    void RawKeyword::addRawRecordString(const std::string& partialRecordString) {
-        m_partialRecordString += " " + partialRecordString;
+    void RawKeyword::addRawRecordString(const string_view& partialRecordString) {
+        if (m_skipRecords) {
+            skipRawRecordString( partialRecordString );
+            return;
+        }
+
+        m_partialRecordString.push_back(' ');
+        m_partialRecordString.append(partialRecordString.begin(), partialRecordString.end());
 
         if (m_sizeType != Raw::FIXED && isTerminator( m_partialRecordString )) {
             if (m_sizeType == Raw::TABLE_COLLECTION) {
@@ -93,7 +103,7 @@ namespace Opm {
 
         if (!m_isFinished) {
             if (RawRecord::isTerminatedRecordString(partialRecordString)) {
-                RawRecordPtr record(new RawRecord(m_partialRecordString, m_filename, m_name));
+                RawRecordPtr record(new RawRecord(std::move(m_partialRecordString), m_filename, m_name));
                 m_records.push_back(record);
                 m_partialRecordString.clear();
 
@@ -103,12 +113,63 @@ namespace Opm {
         }
     }
 
-    bool RawKeyword::isTerminator(std::string line) {
-        boost::algorithm::trim_left( line );
-        if (line[0] == RawConsts::slash) {
-            return true;
-        } else
-            return false;
+    /*
+      The same record and terminator logic as addRawRecordString(), but
+      without the partial record string: isTerminator() only looks at
+      the first non blank character of the partial record, which is all
+      that is kept.
+    */
+    void RawKeyword::skipRawRecordString(const string_view& partialRecordString) {
+        if (m_partialFirstChar == 0) {
+            for (auto iter = partialRecordString.begin(); iter != partialRecordString.end(); ++iter) {
+                if (!std::isspace(static_cast<unsigned char>(*iter))) {
+                    m_partialFirstChar = *iter;
+                    break;
+                }
+            }
+        }
+
+        if (m_sizeType != Raw::FIXED && m_partialFirstChar == RawConsts::slash) {
+            if (m_sizeType == Raw::TABLE_COLLECTION) {
+                m_currentNumTables += 1;
+                if (m_currentNumTables == m_numTables) {
+                    m_isFinished = true;
+                    m_partialFirstChar = 0;
+                }
+            } else if (m_sizeType != Raw::UNKNOWN) {
+                m_isFinished = true;
+                m_partialFirstChar = 0;
+            }
+        }
+
+        if (!m_isFinished) {
+            if (RawRecord::isTerminatedRecordString(partialRecordString)) {
+                m_numSkippedRecords++;
+                m_partialFirstChar = 0;
+
+                if (m_sizeType == Raw::FIXED && (m_numSkippedRecords == m_fixedSize))
+                    m_isFinished = true;
+            }
+        }
+    }
+
+
+    void RawKeyword::skipRecords() {
+        m_skipRecords = true;
+    }
+
+
+    bool RawKeyword::isSkipped() const {
+        return m_skipRecords;
+    }
+
+
+    bool RawKeyword::isTerminator(const string_view& line) {
+        for (auto iter = line.begin(); iter != line.end(); ++iter) {
+            if (!std::isspace(static_cast<unsigned char>(*iter)))
+                return (*iter == RawConsts::slash);
+        }
+        return false;
     }
 
 
@@ -27,6 +27,7 @@
 
 #include <opm/parser/eclipse/RawDeck/RawRecord.hpp>
 #include <opm/parser/eclipse/RawDeck/RawEnums.hpp>
+#include <opm/parser/eclipse/Utility/Stringview.hpp>
 
 namespace Opm {
 
@@ -41,17 +42,23 @@ namespace Opm {
         RawKeyword(const std::string& name , const std::string& filename, size_t lineNR , size_t inputSize , bool isTableCollection = false);
 
         const std::string& getKeywordName() const;
-        void addRawRecordString(const std::string& partialRecordString);
+        void addRawRecordString(const string_view& partialRecordString);
         size_t size() const;
         Raw::KeywordSizeEnum getSizeType() const;
         RawRecordPtr getRecord(size_t index) const;
 
         static bool isKeywordPrefix(const std::string& line, std::string& keywordName);
-        static bool isTerminator(std::string line);
+        static bool isTerminator(const string_view& line);
 
 
         bool isPartialRecordStringEmpty() const;
         bool isFinished() const;
+
+        /// A skipped keyword only keeps track of where its records end;
+        /// the record strings are not stored, and size() is zero.
+        void skipRecords();
+        bool isSkipped() const;
+
         bool unKnownSize() const;
         void finalizeUnknownSize();
 
@@ -68,11 +75,15 @@ namespace Opm {
         std::string m_name;
         std::vector<RawRecordPtr> m_records;
         std::string m_partialRecordString;
+        bool m_skipRecords;
+        size_t m_numSkippedRecords;
+        char m_partialFirstChar;
 
         size_t m_lineNR;
         std::string m_filename;
 
         void commonInit(const std::string& name,const std::string& filename, size_t lineNR);
+        void skipRawRecordString(const string_view& partialRecordString);
         void setKeywordName(const std::string& keyword);
         static bool isValidKeyword(const std::string& keywordCandidate);
     };
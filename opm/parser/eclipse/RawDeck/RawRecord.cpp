@@ -18,7 +18,8 @@
  */
 #include <iostream>
 #include <stdexcept>
-#include <boost/algorithm/string.hpp>
+#include <algorithm>
+#include <cctype>
 
 #include <opm/parser/eclipse/RawDeck/RawRecord.hpp>
 #include <opm/parser/eclipse/RawDeck/RawConsts.hpp>
@@ -37,10 +38,9 @@ namespace Opm {
      * exception is thrown.
      *
      */
-    RawRecord::RawRecord(const std::string& singleRecordString, const std::string& fileName, const std::string& keywordName) : m_fileName(fileName), m_keywordName(keywordName){
+    RawRecord::RawRecord(std::string singleRecordString, const std::string& fileName, const std::string& keywordName) : m_isSplit(false), m_fileName(fileName), m_keywordName(keywordName){
         if (isTerminatedRecordString(singleRecordString)) {
-            setRecordString(singleRecordString);
-            splitSingleRecordString();
+            setRecordString(std::move(singleRecordString));
         } else {
             throw std::invalid_argument("Input string is not a complete record string,"
                     " offending string: " + singleRecordString);
@@ -56,31 +56,72 @@ namespace Opm {
     }
 
 
-    std::string RawRecord::pop_front() {
-        std::string front = m_recordItems.front();
+    string_view RawRecord::pop_front() {
+        splitSingleRecordString();
+        string_view front = m_recordItems.front();
         m_recordItems.pop_front();
         return front;
     }
 
 
-    void RawRecord::push_front(std::string token) {
-        m_recordItems.push_front( token );
+    /*
+      Tokens pushed back into the record do not (necessarily) point
+      into the record string, so a copy is kept alive in the
+      m_insertedItems container. Appending to a std::deque does not
+      invalidate references to the existing elements.
+    */
+    void RawRecord::push_front(const std::string& token) {
+        splitSingleRecordString();
+        m_insertedItems.push_back( token );
+        m_recordItems.push_front( string_view( m_insertedItems.back() ) );
+    }
+
+
+    /*
+      Inserts count copies of the token at the front of the record
+      without copying the characters; the token must be a view into
+      this record or refer to storage with static lifetime, e.g. a
+      string literal.
+    */
+    void RawRecord::push_front(const string_view& token, size_t count) {
+        splitSingleRecordString();
+        m_recordItems.insert( m_recordItems.begin() , count , token );
     }
 
 
     size_t RawRecord::size() const {
+        splitSingleRecordString();
         return m_recordItems.size();
     }
 
+
+    /*
+      If the record has not been split yet and contains no quotes, the
+      complete record string is returned in recordString and the record
+      is left empty. This allows an item which consumes all the data of
+      a record - e.g. the single item of PERMX or ZCORN - to scan the
+      record string directly without first splitting it in a deque of
+      elements.
+    */
+    bool RawRecord::takeUnsplitRecord(string_view& recordString) {
+        if (m_isSplit || m_sanitizedRecordString.find(RawConsts::quote) != std::string::npos)
+            return false;
+
+        recordString = string_view( m_sanitizedRecordString );
+        m_isSplit = true;
+        return true;
+    }
+
     void RawRecord::dump() const {
         std::cout << "RecordDump: ";
-        for (size_t i = 0; i < m_recordItems.size(); i++)
+        for (size_t i = 0; i < size(); i++)
             std::cout << m_recordItems[i] << "/" << getItem(i) << " ";
         std::cout << std::endl;
     }
 
 
-    const std::string& RawRecord::getItem(size_t index) const {
+    string_view RawRecord::getItem(size_t index) const {
+        splitSingleRecordString();
         if (index < m_recordItems.size())
             return m_recordItems[index];
         else
@@ -91,71 +132,80 @@ namespace Opm {
         return m_sanitizedRecordString;
     }
 
-    bool RawRecord::isTerminatedRecordString(const std::string& candidateRecordString) {
-        unsigned int terminatingSlash = findTerminatingSlash(candidateRecordString);
+    bool RawRecord::isTerminatedRecordString(const string_view& candidateRecordString) {
+        size_t terminatingSlash = findTerminatingSlash(candidateRecordString);
         bool hasTerminatingSlash = (terminatingSlash < candidateRecordString.size());
         int numberOfQuotes = std::count(candidateRecordString.begin(), candidateRecordString.end(), RawConsts::quote);
         bool hasEvenNumberOfQuotes = (numberOfQuotes % 2) == 0;
         return hasTerminatingSlash && hasEvenNumberOfQuotes;
     }
 
-    void RawRecord::splitSingleRecordString() {
-        char currentChar;
-        char tokenStartCharacter=' ';
-        std::string currentToken = "";
+    /*
+      Splits the sanitized record string in tokens separated by
+      whitespace; whitespace inside quotes does not split. The tokens
+      are stored as views into m_sanitizedRecordString, which must not
+      be modified after this function has run.
+    */
+    void RawRecord::splitSingleRecordString() const {
+        if (m_isSplit)
+            return;
+
+        m_isSplit = true;
+        const char* tokenStart = nullptr;
         bool inQuote = false;
-        for (unsigned i = 0; i < m_sanitizedRecordString.size(); i++) {
-            currentChar = m_sanitizedRecordString[i];
+        const char* begin = m_sanitizedRecordString.data();
+        const char* end = begin + m_sanitizedRecordString.size();
+
+        for (const char* current = begin; current != end; ++current) {
+            char currentChar = *current;
             if (!inQuote && charIsSeparator(currentChar)) {
-                processSeparatorCharacter(currentToken, currentChar, tokenStartCharacter);
-            } else if (currentChar == RawConsts::quote) {
-                inQuote = !inQuote;
-                processNonSpecialCharacters(currentToken, currentChar);
+                if (tokenStart) {
+                    m_recordItems.push_back( string_view( tokenStart , current ));
+                    tokenStart = nullptr;
+                }
             } else {
-                processNonSpecialCharacters(currentToken, currentChar);
-            }
-        }
-        if (currentToken.size() > 0) {
-            m_recordItems.push_back(currentToken);
-            currentToken.clear();
-        }
-    }
+                if (currentChar == RawConsts::quote)
+                    inQuote = !inQuote;
 
-    void RawRecord::processSeparatorCharacter(std::string& currentToken, const char& currentChar, char& tokenStartCharacter) {
-        if (tokenStartCharacter == RawConsts::quote) {
-            currentToken += currentChar;
-        } else {
-            if (currentToken.size() > 0) {
-                m_recordItems.push_back(currentToken);
-                currentToken.clear();
+                if (!tokenStart)
+                    tokenStart = current;
             }
-            tokenStartCharacter = currentChar;
         }
-    }
-
-    void RawRecord::processNonSpecialCharacters(std::string& currentToken, const char& currentChar) {
-        currentToken += currentChar;
+        if (tokenStart)
+            m_recordItems.push_back( string_view( tokenStart , end ));
     }
 
     bool RawRecord::charIsSeparator(char candidate) {
         return std::string::npos != RawConsts::separators.find(candidate);
     }
 
-    void RawRecord::setRecordString(const std::string& singleRecordString) {
-        unsigned terminatingSlash = findTerminatingSlash(singleRecordString);
-        m_sanitizedRecordString = singleRecordString.substr(0, terminatingSlash);
-        boost::trim(m_sanitizedRecordString);
+    /*
+      The record string is trimmed in place, i.e. the (potentially very
+      large) string assembled by the RawKeyword is not copied.
+    */
+    void RawRecord::setRecordString(std::string&& singleRecordString) {
+        size_t end = findTerminatingSlash(singleRecordString);
+        while (end > 0 && std::isspace(static_cast<unsigned char>(singleRecordString[end - 1])))
+            --end;
+
+        size_t begin = 0;
+        while (begin < end && std::isspace(static_cast<unsigned char>(singleRecordString[begin])))
+            ++begin;
+
+        m_sanitizedRecordString = std::move(singleRecordString);
+        m_sanitizedRecordString.erase(end);
+        m_sanitizedRecordString.erase(0, begin);
     }
 
-    unsigned int RawRecord::findTerminatingSlash(const std::string& singleRecordString) {
-        unsigned int terminatingSlash = singleRecordString.find_first_of(RawConsts::slash);
-        unsigned int lastQuotePosition = singleRecordString.find_last_of(RawConsts::quote);
+    size_t RawRecord::findTerminatingSlash(const string_view& singleRecordString) {
+        size_t terminatingSlash = singleRecordString.find(RawConsts::slash);
+        size_t lastQuotePosition = singleRecordString.find_last_of(RawConsts::quote);
 
         // Checks lastQuotePosition vs terminatingSlashPosition,
         // since specifications of WELLS, FILENAMES etc can include slash, but
         // these are always in quotes (and there are no quotes after record-end).
         if (terminatingSlash < lastQuotePosition && lastQuotePosition < singleRecordString.size()) {
-            terminatingSlash = singleRecordString.find_first_of(RawConsts::slash, lastQuotePosition);
+            terminatingSlash = singleRecordString.find(RawConsts::slash, lastQuotePosition);
         }
         return terminatingSlash;
     }
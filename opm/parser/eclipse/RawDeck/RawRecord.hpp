@@ -24,42 +24,54 @@
 #include <deque>
 #include <memory>
 
+#include <opm/parser/eclipse/Utility/Stringview.hpp>
+
 namespace Opm {
 
     /// Class representing the lowest level of the Raw datatypes, a record. A record is simply
     /// a vector containing the record elements, represented as strings. Some logic is present
     /// to handle special elements in a record string, particularly with quote characters.
+    ///
+    /// The record elements are views into the record string owned by the RawRecord; they are
+    /// only valid as long as the RawRecord itself is alive. The record string is split in
+    /// elements the first time they are requested.
 
     class RawRecord {
     public:
-        RawRecord(const std::string& singleRecordString, const std::string& fileName = "", const std::string& keywordName = "");
+        RawRecord(std::string singleRecordString, const std::string& fileName = "", const std::string& keywordName = "");
 
-        std::string pop_front();
-        void push_front(std::string token);
+        string_view pop_front();
+        void push_front(const std::string& token);
+        void push_front(const string_view& token, size_t count);
         size_t size() const;
+        bool takeUnsplitRecord(string_view& recordString);
 
         const std::string& getRecordString() const;
-        const std::string& getItem(size_t index) const;
+        string_view getItem(size_t index) const;
         const std::string& getFileName() const;
         const std::string& getKeywordName() const;
 
-        static bool isTerminatedRecordString(const std::string& candidateRecordString);
+        static bool isTerminatedRecordString(const string_view& candidateRecordString);
         virtual ~RawRecord();
         void dump() const;
 
     private:
+        RawRecord(const RawRecord&) = delete;
+        RawRecord& operator=(const RawRecord&) = delete;
+
         std::string m_sanitizedRecordString;
-        std::deque<std::string> m_recordItems;
+        // the record elements are created lazily by the const
+        // methods size() and getItem(), hence mutable.
+        mutable bool m_isSplit;
+        mutable std::deque<string_view> m_recordItems;
+        std::deque<std::string> m_insertedItems;
         const std::string m_fileName;
         const std::string m_keywordName;
 
-        void setRecordString(const std::string& singleRecordString);
-        void splitSingleRecordString();
-        void processSeparatorCharacter(std::string& currentToken, const char& currentChar, char& tokenStarter);
-        void processQuoteCharacters(std::string& currentToken, const char& currentChar, char& tokenStarter);
-        void processNonSpecialCharacters(std::string& currentToken, const char& currentChar);
-        bool charIsSeparator(char candidate);
-        static unsigned int findTerminatingSlash(const std::string& singleRecordString);
+        void setRecordString(std::string&& singleRecordString);
+        void splitSingleRecordString() const;
+        static bool charIsSeparator(char candidate);
+        static size_t findTerminatingSlash(const string_view& singleRecordString);
     };
     typedef std::shared_ptr<RawRecord> RawRecordPtr;
     typedef std::shared_ptr<const RawRecord> RawRecordConstPtr;
@@ -17,6 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cctype>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <stdexcept>
 #include <boost/lexical_cast.hpp>
@@ -26,9 +29,9 @@
 
 namespace Opm {
 
-    bool isStarToken(const std::string& token,
-                           std::string& countString,
-                           std::string& valueString) {
+    bool isStarToken(const string_view& token,
+                           string_view& countString,
+                           string_view& valueString) {
         // find first character which is not a digit
         size_t pos = 0;
         for (; pos < token.length(); ++pos)
@@ -50,7 +53,7 @@ namespace Opm {
         // accept these and we would stay as closely to the spec as
         // possible.)
         else if (pos == 0) {
-            countString = "";
+            countString = string_view();
             valueString = token.substr(pos + 1);
             return true;
         }
@@ -58,10 +61,10 @@ namespace Opm {
         // if a star is prefixed by an unsigned integer N, then this should be
         // interpreted as "repeat value after star N times"
         try {
-            boost::lexical_cast<int>(token.substr(0, pos));
+            readValueToken<int>(token.substr(0, pos));
         }
         catch (...) {
-            // the lexical cast may fail as the number of digits may be too large...
+            // the conversion may fail as the number of digits may be too large...
             return false;
         }
 
@@ -69,4 +72,189 @@ namespace Opm {
         valueString = token.substr(pos + 1);
         return true;
     }
+
+
+    bool isStarToken(const std::string& token,
+                           std::string& countString,
+                           std::string& valueString) {
+        string_view countView;
+        string_view valueView;
+
+        if (!isStarToken(string_view(token), countView, valueView))
+            return false;
+
+        countString = countView.string();
+        valueString = valueView.string();
+        return true;
+    }
+
+
+    /*
+      Parses [+-]digits with overflow checking; the complete token must
+      be consumed, i.e. the same strings as boost::lexical_cast<int>
+      are accepted.
+    */
+    template <>
+    int readValueToken<int>(const string_view& valueString) {
+        const char* iter = valueString.begin();
+        const char* end = valueString.end();
+        bool negative = false;
+
+        if (iter != end && (*iter == '-' || *iter == '+')) {
+            negative = (*iter == '-');
+            ++iter;
+        }
+
+        if (iter == end)
+            throw std::invalid_argument("Unable to convert string '" + valueString.string() + "' to int");
+
+        const int64_t limit = negative ? -int64_t(std::numeric_limits<int>::min()) : std::numeric_limits<int>::max();
+        int64_t value = 0;
+        for (; iter != end; ++iter) {
+            unsigned digit = static_cast<unsigned char>(*iter) - '0';
+            if (digit > 9)
+                throw std::invalid_argument("Unable to convert string '" + valueString.string() + "' to int");
+
+            value = 10 * value + digit;
+            if (value > limit)
+                throw std::invalid_argument("Unable to convert string '" + valueString.string() + "' to int");
+        }
+
+        return static_cast<int>(negative ? -value : value);
+    }
+
+
+    /*
+      Tries to convert the token using only integer arithmetic and a
+      single floating point multiplication or division. When the
+      mantissa has at most 15 significant digits it is exactly
+      representable as a double, and when the decimal exponent is in
+      the range [-22, 22] the power of ten is exact as well; in that
+      case the result is correctly rounded (Clinger's fast path). The
+      function returns false for everything else - long mantissas,
+      large exponents, inf/nan and malformed tokens - and the caller
+      falls back to the general conversion.
+    */
+    static bool fastReadDouble(const string_view& valueString, double& result) {
+        static const double powersOfTen[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+        const int maxDigits = 15;
+        const int maxPower = 22;
+
+        const char* iter = valueString.begin();
+        const char* end = valueString.end();
+        bool negative = false;
+
+        if (iter != end && (*iter == '-' || *iter == '+')) {
+            negative = (*iter == '-');
+            ++iter;
+        }
+
+        uint64_t mantissa = 0;
+        int significantDigits = 0;
+        int numDigits = 0;
+        int exponent = 0;
+
+        for (; iter != end && std::isdigit(static_cast<unsigned char>(*iter)); ++iter, ++numDigits) {
+            if (mantissa == 0 && *iter == '0')
+                continue;
+
+            if (++significantDigits > maxDigits)
+                return false;
+
+            mantissa = 10 * mantissa + (*iter - '0');
+        }
+
+        if (iter != end && *iter == '.') {
+            for (++iter; iter != end && std::isdigit(static_cast<unsigned char>(*iter)); ++iter, ++numDigits) {
+                exponent--;
+                if (mantissa == 0 && *iter == '0')
+                    continue;
+
+                if (++significantDigits > maxDigits)
+                    return false;
+
+                mantissa = 10 * mantissa + (*iter - '0');
+            }
+        }
+
+        if (numDigits == 0)
+            return false;
+
+        if (iter != end) {
+            if (*iter != 'e' && *iter != 'E' && *iter != 'd' && *iter != 'D')
+                return false;
+
+            ++iter;
+            bool negativeExponent = false;
+            if (iter != end && (*iter == '-' || *iter == '+')) {
+                negativeExponent = (*iter == '-');
+                ++iter;
+            }
+
+            if (iter == end)
+                return false;
+
+            int explicitExponent = 0;
+            for (; iter != end; ++iter) {
+                if (!std::isdigit(static_cast<unsigned char>(*iter)))
+                    return false;
+
+                explicitExponent = 10 * explicitExponent + (*iter - '0');
+                if (explicitExponent > 10000)
+                    return false;
+            }
+
+            exponent += negativeExponent ? -explicitExponent : explicitExponent;
+        }
+
+        if (mantissa == 0)
+            exponent = 0;
+
+        if (exponent < -maxPower || exponent > maxPower)
+            return false;
+
+        double value = static_cast<double>(mantissa);
+        if (exponent < 0)
+            value /= powersOfTen[-exponent];
+        else
+            value *= powersOfTen[exponent];
+
+        result = negative ? -value : value;
+        return true;
+    }
+
+
+    template <>
+    double readValueToken<double>(const string_view& valueString) {
+        double value;
+        if (fastReadDouble(valueString, value))
+            return value;
+
+        // Eclipse supports Fortran syntax for specifying exponents of floating point
+        // numbers ('D' and 'E', e.g., 1.234d5) while C++ only supports the 'e' (e.g.,
+        // 1.234e5). For the tokens which are not handled by fastReadDouble() the 'D'
+        // is replaced by 'E' and 'd' by 'e' in a stack buffer before the general
+        // conversion is attempted.
+        char buffer[128];
+        std::string heapBuffer;
+        char* converted = buffer;
+        if (valueString.size() > sizeof buffer) {
+            heapBuffer = valueString.string();
+            converted = &heapBuffer[0];
+        }
+
+        for (size_t i = 0; i < valueString.size(); i++) {
+            char c = valueString[i];
+            converted[i] = (c == 'D') ? 'E' : ((c == 'd') ? 'e' : c);
+        }
+
+        try {
+            return boost::lexical_cast<double>(converted, valueString.size());
+        }
+        catch (boost::bad_lexical_cast&) {
+            throw std::invalid_argument("Unable to convert string '" + valueString.string() + "' to double");
+        }
+    }
 }
@@ -26,70 +26,70 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <opm/parser/eclipse/Utility/Stringview.hpp>
+
 namespace Opm {
+    bool isStarToken(const string_view& token,
+                           string_view& countString,
+                           string_view& valueString);
+
     bool isStarToken(const std::string& token,
                            std::string& countString,
                            std::string& valueString);
 
     template <class T>
-    T readValueToken(const std::string& valueString) {
+    T readValueToken(const string_view& valueString) {
         try {
-            return boost::lexical_cast<T>(valueString);
+            return boost::lexical_cast<T>(valueString.begin(), valueString.size());
         }
         catch (boost::bad_lexical_cast&) {
-            throw std::invalid_argument("Unable to convert string '" + valueString + "' to typeid: " + typeid(T).name());
+            throw std::invalid_argument("Unable to convert string '" + valueString.string() + "' to typeid: " + typeid(T).name());
         }
     }
 
+    /*
+      The int and double conversions are the per-token hot path when
+      parsing grid properties, they are implemented in StarToken.cpp
+      without going through boost::lexical_cast. Fortran style
+      exponents ('D' and 'd', e.g. 1.234d5) are accepted for double.
+    */
     template <>
-    inline double readValueToken<double>(const std::string& valueString) {
-        try {
-            return boost::lexical_cast<double>(valueString);
-        }
-        catch (boost::bad_lexical_cast&) {
-            // Eclipse supports Fortran syntax for specifying exponents of floating point
-            // numbers ('D' and 'E', e.g., 1.234d5) while C++ only supports the 'e' (e.g.,
-            // 1.234e5). the quick fix is to replace 'D' by 'E' and 'd' by 'e' before trying
-            // to convert the string into a floating point value. This may not be the most
-            // performant thing to do, but it is probably fast enough.
-            std::string vs(valueString);
-            std::replace(vs.begin(), vs.end(), 'D', 'E');
-            std::replace(vs.begin(), vs.end(), 'd', 'e');
-
-            try { return boost::lexical_cast<double>(vs); }
-            catch (boost::bad_lexical_cast&) {
-                throw std::invalid_argument("Unable to convert string '" + valueString + "' to double");
-            }
-        }
-    }
+    int readValueToken<int>(const string_view& valueString);
 
     template <>
-    inline float readValueToken<float>(const std::string& valueString) {
+    double readValueToken<double>(const string_view& valueString);
+
+    template <>
+    inline float readValueToken<float>(const string_view& valueString) {
         return readValueToken<double>(valueString);
     }
 
     template <>
-    inline std::string readValueToken<std::string>(const std::string& valueString) {
+    inline std::string readValueToken<std::string>(const string_view& valueString) {
         if (valueString.size() > 0 && valueString[0] == '\'') {
             if (valueString.size() < 2 || valueString[valueString.size() - 1] != '\'')
-                throw std::invalid_argument("Unable to parse string '" + valueString + "' as a string token");
-            return valueString.substr(1, valueString.size() - 2);
+                throw std::invalid_argument("Unable to parse string '" + valueString.string() + "' as a string token");
+            return valueString.substr(1, valueString.size() - 2).string();
         }
         else
-            return valueString;
+            return valueString.string();
     }
 
 
+/*
+  The count and value strings are views into the token the StarToken
+  was created from, i.e. that token must outlive the StarToken.
+*/
 class StarToken {
 public:
-    StarToken(const std::string& token)
+    StarToken(const string_view& token)
     {
         if (!isStarToken(token, m_countString, m_valueString))
-            throw std::invalid_argument("Token \""+token+"\" is not a repetition specifier");
+            throw std::invalid_argument("Token \""+token.string()+"\" is not a repetition specifier");
         init_(token);
     }
 
-    StarToken(const std::string& token, const std::string& countStr, const std::string& valueStr)
+    StarToken(const string_view& token, const string_view& countStr, const string_view& valueStr)
         : m_countString(countStr)
         , m_valueString(valueStr)
     {
@@ -107,7 +107,7 @@ public:
     // returns the coubt as rendered in the deck. note that this might be different
     // than just converting the return value of count() to a string because an empty
     // count is interpreted as 1...
-    const std::string& countString() const {
+    const string_view& countString() const {
         return m_countString;
     }
 
@@ -116,37 +116,37 @@ public:
     // might have different representations in the deck (e.g. strings can be
     // specified with and without quotes and but spaces are only allowed using the
     // first representation.)
-    const std::string& valueString() const {
+    const string_view& valueString() const {
         return m_valueString;
     }
 
 private:
     // internal initialization method. the m_countString and m_valueString attributes
     // must be set before calling this method.
-    void init_(const std::string& token) {
+    void init_(const string_view& token) {
         // special-case the interpretation of a lone star as "1*" but do not
         // allow constructs like "*123"...
-        if (m_countString == "") {
-            if (m_valueString != "")
+        if (m_countString.empty()) {
+            if (!m_valueString.empty())
                 // TODO: decorate the deck with a warning instead?
-                throw std::invalid_argument("Not specifying a count also implies not specifying a value. Token: \'" + token + "\'.");
+                throw std::invalid_argument("Not specifying a count also implies not specifying a value. Token: \'" + token.string() + "\'.");
 
             // TODO: since this is explicitly forbidden by the documentation it might
             // be a good idea to decorate the deck with a warning?
             m_count = 1;
         }
         else {
-            m_count = boost::lexical_cast<int>(m_countString);
+            m_count = readValueToken<int>(m_countString);
 
             if (m_count == 0)
                 // TODO: decorate the deck with a warning instead?
-                throw std::invalid_argument("Specifing zero repetitions is not allowed. Token: \'" + token + "\'.");
+                throw std::invalid_argument("Specifing zero repetitions is not allowed. Token: \'" + token.string() + "\'.");
         }
     }
 
     ssize_t m_count;
-    std::string m_countString;
-    std::string m_valueString;
+    string_view m_countString;
+    string_view m_valueString;
 };
 }
 
@@ -0,0 +1,117 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE RawInputBufferTests
+#include <fstream>
+#include <stdexcept>
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <opm/parser/eclipse/RawDeck/RawInputBuffer.hpp>
+
+using namespace Opm;
+
+BOOST_AUTO_TEST_CASE(StringInputLinesSplit) {
+    RawInputBuffer buffer(std::string("LINE1\n\n  LINE3\r\nLINE4"));
+    string_view line;
+
+    BOOST_CHECK( buffer.getLine( line ));
+    BOOST_CHECK_EQUAL( "LINE1" , line );
+    BOOST_CHECK( buffer.getLine( line ));
+    BOOST_CHECK( line.empty() );
+    BOOST_CHECK( buffer.getLine( line ));
+    BOOST_CHECK_EQUAL( "  LINE3\r" , line );
+    BOOST_CHECK( buffer.getLine( line ));
+    BOOST_CHECK_EQUAL( "LINE4" , line );
+    BOOST_CHECK( !buffer.getLine( line ));
+    BOOST_CHECK( !buffer.isMapped() );
+}
+
+BOOST_AUTO_TEST_CASE(TrailingNewlineGivesNoExtraLine) {
+    RawInputBuffer buffer(std::string("LINE1\n"));
+    string_view line;
+
+    BOOST_CHECK( buffer.getLine( line ));
+    BOOST_CHECK_EQUAL( "LINE1" , line );
+    BOOST_CHECK( !buffer.getLine( line ));
+}
+
+BOOST_AUTO_TEST_CASE(EmptyInput) {
+    RawInputBuffer buffer(std::string(""));
+    string_view line;
+
+    BOOST_CHECK_EQUAL( 0U , buffer.size() );
+    BOOST_CHECK( !buffer.getLine( line ));
+}
+
+BOOST_AUTO_TEST_CASE(MissingFileThrows) {
+    BOOST_CHECK_THROW( RawInputBuffer( boost::filesystem::path("does/not/exist.DATA") ) , std::runtime_error );
+}
+
+BOOST_AUTO_TEST_CASE(FileIsMapped) {
+    boost::filesystem::path inputFile = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("RawInputBuffer-%%%%%%.DATA");
+    {
+        std::ofstream stream( inputFile.string().c_str() );
+        stream << "RUNSPEC" << std::endl << "DIMENS" << std::endl << " 10 10 10 /";
+    }
+
+    {
+        RawInputBuffer buffer( inputFile );
+        string_view line;
+
+        BOOST_CHECK( buffer.isMapped() );
+        BOOST_CHECK_EQUAL( boost::filesystem::file_size( inputFile ) , buffer.size() );
+        BOOST_CHECK( buffer.getLine( line ));
+        BOOST_CHECK_EQUAL( "RUNSPEC" , line );
+        BOOST_CHECK( buffer.getLine( line ));
+        BOOST_CHECK_EQUAL( "DIMENS" , line );
+        BOOST_CHECK( buffer.getLine( line ));
+        BOOST_CHECK_EQUAL( " 10 10 10 /" , line );
+        BOOST_CHECK( !buffer.getLine( line ));
+    }
+
+    boost::filesystem::remove( inputFile );
+}
+
+BOOST_AUTO_TEST_CASE(ReleasedPagesAreStillReadable) {
+    boost::filesystem::path inputFile = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("RawInputBuffer-%%%%%%.DATA");
+    const size_t numLines = 1000000;
+    {
+        std::ofstream stream( inputFile.string().c_str() );
+        for (size_t index = 0; index < numLines; index++)
+            stream << "LINE " << index << std::endl;
+    }
+
+    {
+        RawInputBuffer buffer( inputFile );
+        string_view firstLine;
+        string_view line;
+        size_t count = 1;
+
+        buffer.releaseConsumedPages( true );
+        BOOST_CHECK( buffer.getLine( firstLine ));
+        while (buffer.getLine( line ))
+            count++;
+
+        BOOST_CHECK_EQUAL( numLines , count );
+        BOOST_CHECK_EQUAL( "LINE 0" , firstLine );
+        BOOST_CHECK_EQUAL( "LINE 999999" , line );
+    }
+
+    boost::filesystem::remove( inputFile );
+}
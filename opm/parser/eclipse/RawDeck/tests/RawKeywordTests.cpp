@@ -19,6 +19,8 @@
 
 #define BOOST_TEST_MODULE RawKeywordTests
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 #include <opm/parser/eclipse/RawDeck/RawKeyword.hpp>
 #include <opm/parser/eclipse/RawDeck/RawEnums.hpp>
@@ -182,3 +184,47 @@ BOOST_AUTO_TEST_CASE(isUnknownSize) {
     BOOST_CHECK_EQUAL( Raw::UNKNOWN  , keyword.getSizeType( ));
  }
 
+
+BOOST_AUTO_TEST_CASE(SkippedKeywordFinishesLikeParsed) {
+    const std::vector<std::string> fixedLines = { "1 2 3" , " 4 '/ quoted' /" , "5 /" , "6 /" };
+    const std::vector<std::string> slashLines = { "'W1' 1 /" , "'W2'" , " 2 /" , "  /" , "NEXT" };
+    const std::vector<std::string> tableLines = { "1 2" , "3 4 /" , "/" , "5 6 /" , "/" , "7 8 /" };
+
+    auto finishedAfter = [](RawKeyword& keyword , const std::vector<std::string>& lines) {
+        size_t numLines = 0;
+        for (const auto& line : lines) {
+            if (keyword.isFinished())
+                break;
+            keyword.addRawRecordString( line );
+            numLines++;
+        }
+        return numLines;
+    };
+
+    {
+        RawKeyword parsed("TEST" , "FILE" , 10U , 2U);
+        RawKeyword skipped("TEST" , "FILE" , 10U , 2U);
+        skipped.skipRecords();
+        BOOST_CHECK_EQUAL( 3U , finishedAfter( parsed , fixedLines ));
+        BOOST_CHECK_EQUAL( 3U , finishedAfter( skipped , fixedLines ));
+        BOOST_CHECK( skipped.isSkipped() );
+        BOOST_CHECK_EQUAL( 2U , parsed.size() );
+        BOOST_CHECK_EQUAL( 0U , skipped.size() );
+    }
+
+    {
+        RawKeyword parsed("TEST" , Raw::SLASH_TERMINATED , "FILE" , 10U);
+        RawKeyword skipped("TEST" , Raw::SLASH_TERMINATED , "FILE" , 10U);
+        skipped.skipRecords();
+        BOOST_CHECK_EQUAL( 4U , finishedAfter( parsed , slashLines ));
+        BOOST_CHECK_EQUAL( 4U , finishedAfter( skipped , slashLines ));
+    }
+
+    {
+        RawKeyword parsed("TEST" , "FILE" , 10U , 2U , true);
+        RawKeyword skipped("TEST" , "FILE" , 10U , 2U , true);
+        skipped.skipRecords();
+        BOOST_CHECK_EQUAL( 5U , finishedAfter( parsed , tableLines ));
+        BOOST_CHECK_EQUAL( 5U , finishedAfter( skipped , tableLines ));
+    }
+}
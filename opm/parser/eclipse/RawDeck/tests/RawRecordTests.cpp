@@ -111,3 +111,21 @@ BOOST_AUTO_TEST_CASE(Rawrecord_FileAndKeywordGiven_CorrectStringsReturned) {
 
 
 
+
+BOOST_AUTO_TEST_CASE(Rawrecord_takeUnsplitRecord) {
+    Opm::RawRecord record(" 1 2 3*4.5 /");
+    Opm::string_view recordString;
+
+    BOOST_CHECK( record.takeUnsplitRecord( recordString ));
+    BOOST_CHECK_EQUAL( "1 2 3*4.5" , recordString );
+    BOOST_CHECK_EQUAL( 0U , record.size() );
+    BOOST_CHECK( !record.takeUnsplitRecord( recordString ));
+
+    Opm::RawRecord splitRecord("1 2 /");
+    BOOST_CHECK_EQUAL( 2U , splitRecord.size() );
+    BOOST_CHECK( !splitRecord.takeUnsplitRecord( recordString ));
+
+    Opm::RawRecord quotedRecord("'A B' 2 /");
+    BOOST_CHECK( !quotedRecord.takeUnsplitRecord( recordString ));
+    BOOST_CHECK_EQUAL( 2U , quotedRecord.size() );
+}
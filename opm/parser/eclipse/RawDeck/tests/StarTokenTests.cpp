@@ -18,6 +18,7 @@
  */
 
 #define BOOST_TEST_MODULE ParserTests
+#include <cstdlib>
 #include <stdexcept>
 #include <boost/test/unit_test.hpp>
 #include <opm/parser/eclipse/RawDeck/StarToken.hpp>
@@ -115,3 +116,47 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>("123*456") );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>("'123*456'") );
 }
+
+BOOST_AUTO_TEST_CASE( readValueToken_int ) {
+    BOOST_CHECK_EQUAL( 0 , Opm::readValueToken<int>("0") );
+    BOOST_CHECK_EQUAL( 17 , Opm::readValueToken<int>("+17") );
+    BOOST_CHECK_EQUAL( -17 , Opm::readValueToken<int>("-17") );
+    BOOST_CHECK_EQUAL( 2147483647 , Opm::readValueToken<int>("2147483647") );
+    BOOST_CHECK_EQUAL( -2147483647 - 1 , Opm::readValueToken<int>("-2147483648") );
+
+    BOOST_CHECK_THROW( Opm::readValueToken<int>("2147483648"), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>("-"), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>(""), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>("12X"), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>("1E5"), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( readValueToken_double_matches_strtod ) {
+    const char* tokens[] = { "0", "-0.0", "1", "+2.5", ".5", "1.", "0.1", "0.3", "123.456",
+                             "1e22", "1e-22", "1.7976931348623157e308", "4.9e-324",
+                             "3.14159265358979323846", "0.000001234", "100000000000000000000000",
+                             "-1.0E-5", "2.5E+03", "987654321012345", "9876543210123456" };
+
+    for (const char* token : tokens)
+        BOOST_CHECK_EQUAL( std::strtod(token, nullptr) , Opm::readValueToken<double>(token) );
+
+    BOOST_CHECK_EQUAL( 2.5e3 , Opm::readValueToken<double>("2.5D3") );
+    BOOST_CHECK_EQUAL( -2.5e-30 , Opm::readValueToken<double>("-2.5d-30") );
+
+    BOOST_CHECK_THROW( Opm::readValueToken<double>(""), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>("1.0X"), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>("1.0E"), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>("1*2"), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( StarToken_views_into_token ) {
+    std::string token("10*0.25");
+    Opm::string_view countString;
+    Opm::string_view valueString;
+
+    BOOST_CHECK( Opm::isStarToken( Opm::string_view(token) , countString , valueString ));
+    BOOST_CHECK_EQUAL( "10" , countString );
+    BOOST_CHECK_EQUAL( "0.25" , valueString );
+    BOOST_CHECK( valueString.begin() == token.data() + 3 );
+    BOOST_CHECK( !Opm::isStarToken( Opm::string_view("99999999999*1") , countString , valueString ));
+}
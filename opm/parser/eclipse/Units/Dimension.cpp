@@ -71,6 +71,10 @@ namespace Opm {
         return m_name;
     }
 
+    bool Dimension::isContextDependent() const {
+        return !std::isfinite(m_SIfactor);
+    }
+
     // only dimensions with zero offset are compositable...
     bool Dimension::isCompositable() const
     { return m_SIoffset == 0.0; }
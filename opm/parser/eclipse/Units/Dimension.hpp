@@ -37,9 +37,14 @@ namespace Opm {
         bool equal(const Dimension& other) const;
         const std::string& getName() const;
         bool isCompositable() const;
+        // true for units without a fixed SI factor, see getSIScaling()
+        bool isContextDependent() const;
         static Dimension * newComposite(const std::string& dim, double SIfactor, double SIoffset = 0.0);
 
     private:
+        // serializes the scaling factor also for context dependent units
+        friend class DeckCache;
+
         Dimension();
         std::string m_name;
         double m_SIfactor;
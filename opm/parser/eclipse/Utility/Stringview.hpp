@@ -0,0 +1,163 @@
+/*
+  Copyright 2015 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPM_UTILITY_STRINGVIEW_HPP
+#define OPM_UTILITY_STRINGVIEW_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+namespace Opm {
+
+    /*
+      A non-owning, read-only view of a contiguous character
+      sequence. The view is only valid as long as the underlying
+      storage is alive and unmodified; it is used by the raw parser to
+      hand out lines and tokens without copying them.
+    */
+
+    class string_view {
+    public:
+        typedef const char* const_iterator;
+
+        string_view() :
+            m_begin( nullptr ),
+            m_end( nullptr )
+        {}
+
+        string_view( const_iterator first , const_iterator last ) :
+            m_begin( first ),
+            m_end( last )
+        {}
+
+        string_view( const_iterator first , size_t length ) :
+            m_begin( first ),
+            m_end( first + length )
+        {}
+
+        string_view( const std::string& str ) :
+            m_begin( str.data() ),
+            m_end( str.data() + str.size() )
+        {}
+
+        string_view( const char* str ) :
+            m_begin( str ),
+            m_end( str + std::strlen( str ) )
+        {}
+
+        const_iterator begin() const { return m_begin; }
+        const_iterator end() const { return m_end; }
+
+        char front() const { return *m_begin; }
+        char back() const { return *(m_end - 1); }
+        char operator[]( size_t index ) const { return m_begin[index]; }
+
+        bool empty() const { return m_begin == m_end; }
+        size_t size() const { return m_end - m_begin; }
+        size_t length() const { return size(); }
+
+        std::string string() const { return std::string( m_begin , m_end ); }
+
+        string_view substr( size_t from , size_t len = std::string::npos ) const {
+            from = std::min( from , size() );
+            len = std::min( len , size() - from );
+            return string_view( m_begin + from , len );
+        }
+
+        size_t find( char c , size_t from = 0 ) const {
+            if (from >= size())
+                return std::string::npos;
+
+            const void* pos = std::memchr( m_begin + from , c , size() - from );
+            return pos ? static_cast< const char* >( pos ) - m_begin : std::string::npos;
+        }
+
+        size_t find( const string_view& needle , size_t from = 0 ) const {
+            if (from > size() || needle.size() > size() - from)
+                return std::string::npos;
+
+            auto pos = std::search( m_begin + from , m_end , needle.begin() , needle.end() );
+            return pos == m_end && !needle.empty() ? std::string::npos : size_t( pos - m_begin );
+        }
+
+        size_t find_first_of( const string_view& chars , size_t from = 0 ) const {
+            for (size_t i = from; i < size(); ++i)
+                if (chars.find( m_begin[i] ) != std::string::npos)
+                    return i;
+
+            return std::string::npos;
+        }
+
+        size_t find_last_of( char c ) const {
+            for (size_t i = size(); i > 0; --i)
+                if (m_begin[i - 1] == c)
+                    return i - 1;
+
+            return std::string::npos;
+        }
+
+        bool operator==( const string_view& other ) const {
+            return size() == other.size() && std::equal( m_begin , m_end , other.m_begin );
+        }
+
+        bool operator!=( const string_view& other ) const {
+            return !(*this == other);
+        }
+
+        bool operator<( const string_view& other ) const {
+            return std::lexicographical_compare( m_begin , m_end , other.m_begin , other.m_end );
+        }
+
+    private:
+        const_iterator m_begin;
+        const_iterator m_end;
+    };
+
+    inline bool operator==( const std::string& lhs , const string_view& rhs ) {
+        return string_view( lhs ) == rhs;
+    }
+
+    inline bool operator==( const string_view& lhs , const std::string& rhs ) {
+        return lhs == string_view( rhs );
+    }
+
+    inline bool operator==( const char* lhs , const string_view& rhs ) {
+        return string_view( lhs ) == rhs;
+    }
+
+    inline bool operator==( const string_view& lhs , const char* rhs ) {
+        return lhs == string_view( rhs );
+    }
+
+    inline bool operator!=( const std::string& lhs , const string_view& rhs ) {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator!=( const string_view& lhs , const std::string& rhs ) {
+        return !(lhs == rhs);
+    }
+
+    inline std::ostream& operator<<( std::ostream& stream , const string_view& view ) {
+        return stream.write( view.begin() , view.size() );
+    }
+}
+
+#endif